@@ -1,8 +1,8 @@
 ExternalProject_Add(
 	google-benchmark-EP
 	GIT_REPOSITORY https://github.com/google/benchmark.git
-	GIT_TAG "v1.4.1"
-	CMAKE_ARGS -DCMAKE_INSTALL_PREFIX=<INSTALL_DIR> -DCMAKE_BUILD_TYPE=RELEASE -DBENCHMARK_DOWNLOAD_DEPENDENCIES=ON
+	GIT_TAG "v1.8.3"
+	CMAKE_ARGS -DCMAKE_INSTALL_PREFIX=<INSTALL_DIR> -DCMAKE_BUILD_TYPE=RELEASE -DCMAKE_INSTALL_LIBDIR=lib -DBENCHMARK_ENABLE_TESTING=OFF
 	UPDATE_COMMAND ""
 )
 set_target_properties(google-benchmark-EP PROPERTIES EXCLUDE_FROM_ALL TRUE)
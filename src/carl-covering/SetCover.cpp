@@ -86,8 +86,12 @@ Bitset SetCover::get_uncovered() const {
 void SetCover::select_set(std::size_t s) {
 	assert(mSets.size() > s);
 	auto selected = mSets[s];
+	remove_elements(selected);
+}
+
+void SetCover::remove_elements(const Bitset& elements) {
 	for (auto& d: mSets){
-		d -= selected;
+		d -= elements;
 	}
 }
 
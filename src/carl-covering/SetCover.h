@@ -46,6 +46,8 @@ public:
 	Bitset get_uncovered() const;
 	/// Selects the given set and purges the covered elements from all other sets.
 	void select_set(std::size_t s);
+	/// Purges the given elements from all sets.
+	void remove_elements(const Bitset& elements);
 };
 
 /// Print the set cover to os.
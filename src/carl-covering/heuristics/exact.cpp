@@ -1,38 +1,204 @@
 #include "exact.h"
 
+#include "greedy.h"
 #include "remove_duplicates.h"
 #include "select_essential.h"
 
 #include <carl/core/logging.h>
 #include <carl/util/Bitset.h>
 
+#include <algorithm>
+#include <cmath>
 #include <optional>
 
 namespace carl::covering::heuristic {
 
-std::optional<Bitset> exact_of_size(const SetCover& sc, const Bitset& uncovered, const std::vector<std::size_t>& id_map, std::size_t size) {
-	std::vector<bool> selection(id_map.size() - size, false);
-	selection.resize(id_map.size(), true);
+namespace {
 
-	do {
-		Bitset covered;
-		for (std::size_t id = 0; id < selection.size(); ++id) {
-			if (selection[id]) {
-				covered |= sc.get_set(id_map[id]);
+/**
+ * Branch and bound search for a minimum set cover.
+ *
+ * Every node branches on the uncovered element that is contained in the fewest available sets and selects each of these sets in turn.
+ * After a set has been explored, it is excluded from the remaining branches.
+ * The reduction rules of the preprocessing are applied at every node:
+ * an element contained in a single set yields a single branch (select_essential),
+ * and a candidate whose uncovered elements are a subset of another candidate is excluded (dominance, generalizing remove_duplicates).
+ * A node is pruned if the selected sets plus a lower bound can not improve on the best cover.
+ * The lower bound is the maximum of two bounds:
+ * the number of uncovered elements that pairwise share no available set, as each of them needs its own set,
+ * and a fractional bound similar to a dual solution of the LP relaxation.
+ */
+class BranchAndBound {
+	using clock = std::chrono::steady_clock;
+
+	/// The sets over the local elements.
+	std::vector<Bitset> mSets;
+	/// The ids of the sets containing every element.
+	std::vector<std::vector<std::size_t>> mContaining;
+	/// Whether a set is excluded in the current node.
+	std::vector<bool> mExcluded;
+	/// Marks the sets used by the lower bound of the node with this number.
+	std::vector<std::size_t> mMarked;
+	/// The number of uncovered elements of every set in the current node.
+	std::vector<std::size_t> mSizes;
+	/// The sets selected in the current node.
+	std::vector<std::size_t> mSelected;
+	/// The best cover found so far.
+	std::vector<std::size_t> mBest;
+	/// Number of explored nodes.
+	std::size_t mNodes = 0;
+	/// Maximum number of nodes, zero for no limit.
+	std::size_t mNodeLimit;
+	/// Time after which the search is stopped.
+	std::optional<clock::time_point> mDeadline;
+	/// Whether the search was stopped by the limits.
+	bool mAborted = false;
+
+	bool out_of_budget() {
+		if (mAborted) return true;
+		if (mNodeLimit > 0 && mNodes >= mNodeLimit) {
+			mAborted = true;
+		} else if (mDeadline && mNodes % 64 == 0 && clock::now() > *mDeadline) {
+			mAborted = true;
+		}
+		return mAborted;
+	}
+
+	std::size_t available(std::size_t element) const {
+		return static_cast<std::size_t>(std::count_if(mContaining[element].begin(), mContaining[element].end(),
+			[this](std::size_t sid){ return !mExcluded[sid]; }
+		));
+	}
+
+	void search(const Bitset& uncovered) {
+		if (uncovered.none()) {
+			if (mSelected.size() < mBest.size()) {
+				mBest = mSelected;
+				CARL_LOG_DEBUG("carl.covering", "Found cover of size " << mBest.size() << " after " << mNodes << " nodes");
 			}
+			return;
+		}
+		if (mSelected.size() + 1 >= mBest.size()) return;
+		if (out_of_budget()) return;
+		++mNodes;
+
+		std::vector<std::pair<std::size_t, std::size_t>> elements;
+		for (std::size_t e: uncovered) {
+			elements.emplace_back(available(e), e);
+			if (elements.back().first == 0) return;
+		}
+		std::sort(elements.begin(), elements.end());
+
+		std::size_t lower = 0;
+		for (const auto& [num, e]: elements) {
+			auto& sets = mContaining[e];
+			bool independent = std::none_of(sets.begin(), sets.end(),
+				[this](std::size_t sid){ return !mExcluded[sid] && mMarked[sid] == mNodes; }
+			);
+			if (!independent) continue;
+			++lower;
+			for (std::size_t sid: sets) mMarked[sid] = mNodes;
 		}
-		if (uncovered.is_subset_of(covered)) {
-			Bitset result;
-			for (std::size_t id = 0; id < selection.size(); ++id) {
-				result.set(id_map[id], selection[id]);
+		if (mSelected.size() + lower >= mBest.size()) return;
+
+		// Every element contributes 1/k where k is the largest number of uncovered elements of an available set containing it.
+		// A set contributes at most one in total, hence the sum is a lower bound.
+		for (std::size_t sid = 0; sid < mSets.size(); ++sid) {
+			mSizes[sid] = mExcluded[sid] ? 0 : (mSets[sid] & uncovered).count();
+		}
+		double fractional = 0;
+		for (const auto& [num, e]: elements) {
+			std::size_t largest = 0;
+			for (std::size_t sid: mContaining[e]) largest = std::max(largest, mSizes[sid]);
+			fractional += 1.0 / static_cast<double>(largest);
+		}
+		lower = std::max(lower, static_cast<std::size_t>(std::ceil(fractional - 1e-9)));
+		if (mSelected.size() + lower >= mBest.size()) return;
+
+		// The available sets containing the branching element, ordered by the number of newly covered elements.
+		std::vector<std::size_t> ids;
+		std::vector<Bitset> covers;
+		for (std::size_t sid: mContaining[elements.front().second]) {
+			if (mExcluded[sid]) continue;
+			ids.emplace_back(sid);
+			covers.emplace_back(mSets[sid] & uncovered);
+		}
+		std::vector<std::size_t> candidates(ids.size());
+		for (std::size_t i = 0; i < ids.size(); ++i) {
+			candidates[i] = i;
+		}
+		std::stable_sort(candidates.begin(), candidates.end(), [this,&ids](std::size_t lhs, std::size_t rhs){ return mSizes[ids[lhs]] > mSizes[ids[rhs]]; });
+
+		std::vector<std::size_t> branches;
+		std::vector<std::size_t> excluded;
+		for (std::size_t c: candidates) {
+			bool dominated = std::any_of(branches.begin(), branches.end(),
+				[&covers,c](std::size_t b){ return covers[c].is_subset_of(covers[b]); }
+			);
+			if (dominated) {
+				excluded.emplace_back(ids[c]);
+			} else {
+				branches.emplace_back(c);
 			}
-			return result;
 		}
-	} while (std::next_permutation(selection.begin(), selection.end()));
-	return std::nullopt;
+		for (std::size_t sid: excluded) mExcluded[sid] = true;
+
+		for (std::size_t b: branches) {
+			std::size_t sid = ids[b];
+			mSelected.emplace_back(sid);
+			Bitset remaining = uncovered;
+			remaining -= covers[b];
+			search(remaining);
+			mSelected.pop_back();
+			mExcluded[sid] = true;
+			excluded.emplace_back(sid);
+			if (mAborted || mSelected.size() + 1 >= mBest.size()) break;
+		}
+		for (std::size_t sid: excluded) mExcluded[sid] = false;
+	}
+
+public:
+	BranchAndBound(std::vector<Bitset>&& sets, std::size_t element_count, std::vector<std::size_t>&& initial, std::size_t node_limit, std::chrono::milliseconds time_limit):
+		mSets(std::move(sets)),
+		mContaining(element_count),
+		mExcluded(mSets.size(), false),
+		mMarked(mSets.size(), 0),
+		mSizes(mSets.size(), 0),
+		mBest(std::move(initial)),
+		mNodeLimit(node_limit)
+	{
+		for (std::size_t sid = 0; sid < mSets.size(); ++sid) {
+			for (std::size_t e: mSets[sid]) {
+				mContaining[e].emplace_back(sid);
+			}
+		}
+		if (time_limit > std::chrono::milliseconds::zero()) {
+			mDeadline = clock::now() + time_limit;
+		}
+	}
+
+	/// Searches for a cover of the given elements that is smaller than the initial one.
+	void run(const Bitset& uncovered) {
+		search(uncovered);
+	}
+	const auto& best() const {
+		return mBest;
+	}
+	bool aborted() const {
+		return mAborted;
+	}
+	std::size_t nodes() const {
+		return mNodes;
+	}
+};
+
 }
 
 Bitset exact(SetCover& sc) {
+	return exact_limited(sc, 0);
+}
+
+Bitset exact_limited(SetCover& sc, std::size_t node_limit, std::chrono::milliseconds time_limit) {
 	Bitset pre;
 	pre |= carl::covering::heuristic::remove_duplicates(sc);
 	CARL_LOG_DEBUG("carl.covering", "Removed duplicates: " << pre << std::endl << sc);
@@ -46,25 +212,52 @@ Bitset exact(SetCover& sc) {
 	}
 	CARL_LOG_DEBUG("carl.covering", "Remaining: " << uncovered);
 
-	// Maps local ids to ids in sc. We only consider active sets for local ids.
+	// Maps local ids to ids in sc. We only consider active sets and uncovered elements.
 	std::vector<std::size_t> id_map;
+	std::vector<std::size_t> local_ids(sc.set_count(), 0);
+	std::vector<std::size_t> element_ids(uncovered.size(), 0);
+	std::size_t element_count = 0;
+	for (std::size_t e: uncovered) {
+		element_ids[e] = element_count++;
+	}
+	std::vector<Bitset> sets;
 	for (std::size_t sid = 0; sid < sc.set_count(); ++sid) {
-		if (sc.get_set(sid).any()) id_map.emplace_back(sid);
+		if (sc.get_set(sid).none()) continue;
+		local_ids[sid] = id_map.size();
+		id_map.emplace_back(sid);
+		Bitset set;
+		for (std::size_t e: sc.get_set(sid)) {
+			set.set(element_ids[e]);
+		}
+		sets.emplace_back(std::move(set));
 	}
 
-	for (std::size_t size = 0; size < sc.active_set_count(); ++size) {
-		auto res = exact_of_size(sc, uncovered, id_map, size);
-		if (res) {
-			for (auto bit: *res) {
-				sc.select_set(bit);
-			}
-			CARL_LOG_DEBUG("carl.covering", "Got exact covering of size " << size << " -> " << *res);
-			return pre | *res;
+	// The greedy cover is the initial upper bound and the fallback.
+	std::vector<std::size_t> initial;
+	{
+		SetCover tmp = sc;
+		for (std::size_t sid: greedy(tmp)) {
+			initial.emplace_back(local_ids[sid]);
 		}
 	}
+	CARL_LOG_DEBUG("carl.covering", "Greedy cover of size " << initial.size());
+
+	BranchAndBound bb(std::move(sets), element_count, std::move(initial), node_limit, time_limit);
+	Bitset all;
+	all.set_interval(0, element_count - 1);
+	bb.run(all);
+	if (bb.aborted()) {
+		CARL_LOG_WARN("carl.covering", "Stopped exact search after " << bb.nodes() << " nodes, using cover of size " << bb.best().size());
+	} else {
+		CARL_LOG_DEBUG("carl.covering", "Got exact covering of size " << bb.best().size() << " after " << bb.nodes() << " nodes");
+	}
 
-	CARL_LOG_ERROR("carl.covering", "Did not find an exact set cover.")
-	return Bitset();
+	Bitset res;
+	for (std::size_t local: bb.best()) {
+		sc.select_set(id_map[local]);
+		res.set(id_map[local]);
+	}
+	return pre | res;
 }
 
-}
\ No newline at end of file
+}
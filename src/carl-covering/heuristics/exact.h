@@ -3,6 +3,8 @@
 #include "../SetCover.h"
 #include "../TypedSetCover.h"
 
+#include <chrono>
+
 namespace carl::covering::heuristic {
 
 /**
@@ -11,4 +13,12 @@ namespace carl::covering::heuristic {
  */
 Bitset exact(SetCover& sc);
 
+/**
+ * Exact "heuristic" with a budget:
+ * Computes a minimum set cover using branch and bound, starting from the greedy cover.
+ * The search stops after node_limit search nodes or after time_limit (zero for no limit).
+ * In this case, the best cover found so far is returned, which is not necessarily minimal.
+ */
+Bitset exact_limited(SetCover& sc, std::size_t node_limit, std::chrono::milliseconds time_limit = std::chrono::milliseconds::zero());
+
 }
\ No newline at end of file
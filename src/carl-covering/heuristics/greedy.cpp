@@ -2,42 +2,151 @@
 
 #include <carl/util/Bitset.h>
 
+#include <limits>
+#include <queue>
+#include <utility>
+#include <vector>
+
 namespace carl::covering::heuristic {
 
-Bitset greedy(SetCover& sc) {
+namespace {
+
+/**
+ * Lazy implementation of the greedy heuristics.
+ * Selects the set with the largest weight until at most bound sets cover uncovered elements.
+ * The weight of a set is given by weight(set id, number of uncovered elements) and must not increase when the number of uncovered elements decreases.
+ *
+ * The number of uncovered elements is maintained for every set by decrementing it for every newly covered element.
+ * The sets are kept in a priority queue whose weights may be outdated, as they only decrease.
+ * Hence, if the weight of the top set is still accurate, it is the largest set.
+ * Otherwise it is reinserted with its current weight.
+ * As for SetCover::largest_set(), ties are broken by selecting the set with the smallest id.
+ * The selected sets are purged from sc once in the end.
+ */
+template<typename Weight>
+Bitset lazy_greedy(SetCover& sc, Weight&& weight, std::size_t bound) {
+	// Number of uncovered elements of every set.
+	std::vector<std::size_t> sizes(sc.set_count(), 0);
+	// Number of sets that cover uncovered elements.
+	std::size_t active = 0;
+	// The sets containing element e are containing[offsets[e]] ... containing[offsets[e+1]-1].
+	std::vector<std::size_t> offsets(sc.element_count() + 1, 0);
+	for (std::size_t sid = 0; sid < sc.set_count(); ++sid) {
+		for (std::size_t element: sc.get_set(sid)) {
+			++offsets[element + 1];
+			++sizes[sid];
+		}
+		if (sizes[sid] > 0) ++active;
+	}
+	for (std::size_t e = 1; e < offsets.size(); ++e) {
+		offsets[e] += offsets[e - 1];
+	}
+	std::vector<std::size_t> containing(offsets.back());
+	{
+		std::vector<std::size_t> next(offsets.begin(), offsets.end() - 1);
+		for (std::size_t sid = 0; sid < sc.set_count(); ++sid) {
+			for (std::size_t element: sc.get_set(sid)) {
+				containing[next[element]++] = sid;
+			}
+		}
+	}
+
+	using Entry = std::pair<double, std::size_t>;
+	auto less = [](const Entry& lhs, const Entry& rhs) {
+		if (lhs.first != rhs.first) return lhs.first < rhs.first;
+		return lhs.second > rhs.second;
+	};
+	std::priority_queue<Entry, std::vector<Entry>, decltype(less)> queue(less);
+	for (std::size_t sid = 0; sid < sc.set_count(); ++sid) {
+		if (sizes[sid] > 0) queue.emplace(weight(sid, sizes[sid]), sid);
+	}
+
 	Bitset result;
-	Bitset uncovered = sc.get_uncovered();
-	while (uncovered.any()) {
-		auto s = sc.largest_set();
-		result.set(s);
-		uncovered -= sc.get_set(s);
-		sc.select_set(s);
+	Bitset covered;
+	while (active > bound && !queue.empty()) {
+		auto [w, sid] = queue.top();
+		queue.pop();
+		if (sizes[sid] == 0) continue;
+		double current = weight(sid, sizes[sid]);
+		if (current != w) {
+			queue.emplace(current, sid);
+			continue;
+		}
+		result.set(sid);
+		for (std::size_t element: sc.get_set(sid)) {
+			if (covered.test(element)) continue;
+			covered.set(element);
+			for (std::size_t i = offsets[element]; i < offsets[element + 1]; ++i) {
+				if (--sizes[containing[i]] == 0) --active;
+			}
+		}
 	}
+	sc.remove_elements(covered);
 	return result;
 }
 
-Bitset greedy_bounded(SetCover& sc, std::size_t bound) {
+/**
+ * Straightforward implementation of the greedy heuristics with the same semantics as lazy_greedy().
+ * Recounts all sets in every step, which only needs word-parallel operations on the bitsets
+ * and is faster than lazy_greedy() if the sets are dense and only few sets are selected.
+ */
+template<typename Weight>
+Bitset scan_greedy(SetCover& sc, Weight&& weight, std::size_t bound) {
 	Bitset result;
-	Bitset uncovered = sc.get_uncovered();
-	while (sc.active_set_count() > bound) {
-		auto s = sc.largest_set();
-		result.set(s);
-		sc.select_set(s);
-		sc.prune_sets();
+	while (true) {
+		std::size_t active = 0;
+		std::size_t best = 0;
+		double best_weight = -std::numeric_limits<double>::infinity();
+		for (std::size_t sid = 0; sid < sc.set_count(); ++sid) {
+			std::size_t size = sc.get_set(sid).count();
+			if (size == 0) continue;
+			++active;
+			double w = weight(sid, size);
+			if (w > best_weight) {
+				best = sid;
+				best_weight = w;
+			}
+		}
+		if (active <= bound) break;
+		result.set(best);
+		sc.select_set(best);
 	}
 	return result;
 }
 
-Bitset greedy_weighted(SetCover& sc, const std::vector<double>& weights, std::size_t bound) {
-	Bitset result;
-	Bitset uncovered = sc.get_uncovered();
-	while (sc.active_set_count() > bound) {
-		auto s = sc.largest_set(weights);
-		result.set(s);
-		sc.select_set(s);
-		sc.prune_sets();
+/**
+ * Runs scan_greedy() on dense and lazy_greedy() on sparse set covers.
+ * A set cover is considered dense if the sets contain on average at least one element per bitset block,
+ * such that the incidence lists of lazy_greedy() are not smaller than the bitsets themselves.
+ */
+template<typename Weight>
+Bitset select_greedy(SetCover& sc, Weight&& weight, std::size_t bound) {
+	std::size_t incidences = 0;
+	for (std::size_t sid = 0; sid < sc.set_count(); ++sid) {
+		incidences += sc.get_set(sid).count();
+	}
+	if (incidences * Bitset::bits_per_block >= sc.set_count() * sc.element_count()) {
+		return scan_greedy(sc, std::forward<Weight>(weight), bound);
 	}
+	return lazy_greedy(sc, std::forward<Weight>(weight), bound);
+}
+
+}
+
+Bitset greedy(SetCover& sc) {
+	return select_greedy(sc, [](std::size_t, std::size_t size){ return static_cast<double>(size); }, 0);
+}
+
+Bitset greedy_bounded(SetCover& sc, std::size_t bound) {
+	auto result = select_greedy(sc, [](std::size_t, std::size_t size){ return static_cast<double>(size); }, bound);
+	sc.prune_sets();
+	return result;
+}
+
+Bitset greedy_weighted(SetCover& sc, const std::vector<double>& weights, std::size_t bound) {
+	auto result = select_greedy(sc, [&weights](std::size_t sid, std::size_t size){ return static_cast<double>(size) * weights[sid]; }, bound);
+	sc.prune_sets();
 	return result;
 }
 
-}
\ No newline at end of file
+}
@@ -20,6 +20,7 @@ Bitset greedy_bounded(SetCover& sc, std::size_t bound = 12);
 /**
  * Weighted greedy heuristic:
  * Selects the largest remaining set according to the given weight function until at most bound constraints remain.
+ * The weights must be non-negative.
  */
 Bitset greedy_weighted(SetCover& sc, const std::vector<double>& weights, std::size_t bound = 0);
 
@@ -0,0 +1,365 @@
+/**
+ * @file CompiledRationalFunction.h
+ */
+
+#pragma once
+
+#include "FactorizedPolynomial.h"
+#include "RationalFunction.h"
+
+#include <carl/core/MultivariatePolynomial.h>
+#include <carl/numbers/numbers.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <map>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace carl {
+
+/**
+ * A rational function that is compiled into a flat program for repeated evaluation.
+ *
+ * The program works on a file of registers, where the first registers hold the values of the variables.
+ * Every power of a variable, every monomial and (for factorized polynomials) every factor is computed only once
+ * and shared between the terms of the numerator and the denominator.
+ * Evaluating the program needs neither lookups in a map nor the construction of intermediate polynomials.
+ *
+ * Points are given as vectors of values, one for every variable in the order of variables().
+ * Batches of points are stored consecutively and can be evaluated in doubles or exactly.
+ * Doubles are evaluated for blocks of points at once, such that every instruction becomes a loop over the points of the block
+ * that the compiler can vectorize.
+ */
+template<typename Number>
+class CompiledRationalFunction {
+public:
+	/// The number of points evaluated at once in double precision.
+	static constexpr std::size_t block_size = 64;
+private:
+	enum class Op: std::uint8_t {
+		/// r[target] = constant[a]
+		Const,
+		/// r[target] += r[a]
+		Add,
+		/// r[target] += constant[a] * r[b]
+		AddMul,
+		/// r[target] = r[a] * r[b]
+		Mul,
+		/// r[target] = r[a] / r[b]
+		Div
+	};
+	struct Instruction {
+		Op op;
+		std::uint32_t target;
+		std::uint32_t a;
+		std::uint32_t b;
+	};
+
+	/// The variables, their values are stored in the first registers.
+	std::vector<Variable> mVariables;
+	std::vector<Instruction> mProgram;
+	std::vector<Number> mConstants;
+	std::vector<double> mDoubleConstants;
+	std::size_t mRegisters = 0;
+	/// The register holding the result.
+	std::uint32_t mResult = 0;
+
+	/// Caches shared subexpressions during the compilation.
+	template<typename Pol>
+	struct Cache {
+		std::map<Number, std::uint32_t> constants;
+		std::map<std::pair<std::uint32_t, std::size_t>, std::uint32_t> powers;
+		std::map<Monomial::Arg, std::uint32_t> monomials;
+		std::map<Pol, std::uint32_t> factors;
+	};
+
+	std::uint32_t new_register() {
+		return static_cast<std::uint32_t>(mRegisters++);
+	}
+	void emit(Op op, std::uint32_t target, std::uint32_t a, std::uint32_t b = 0) {
+		mProgram.emplace_back(Instruction{op, target, a, b});
+	}
+	template<typename C>
+	std::uint32_t constant(const Number& n, C& cache) {
+		auto it = cache.constants.find(n);
+		if (it != cache.constants.end()) return it->second;
+		auto id = static_cast<std::uint32_t>(mConstants.size());
+		mConstants.emplace_back(n);
+		mDoubleConstants.emplace_back(carl::toDouble(n));
+		cache.constants.emplace(n, id);
+		return id;
+	}
+	/// Computes r^exp by repeated squaring, sharing the intermediate powers.
+	template<typename C>
+	std::uint32_t power(std::uint32_t r, std::size_t exp, C& cache) {
+		assert(exp > 0);
+		if (exp == 1) return r;
+		auto it = cache.powers.find(std::make_pair(r, exp));
+		if (it != cache.powers.end()) return it->second;
+		std::uint32_t half = power(r, exp / 2, cache);
+		std::uint32_t res = new_register();
+		emit(Op::Mul, res, half, half);
+		if (exp % 2 == 1) {
+			emit(Op::Mul, res, res, r);
+		}
+		cache.powers.emplace(std::make_pair(r, exp), res);
+		return res;
+	}
+	template<typename C>
+	std::uint32_t monomial(const Monomial::Arg& m, C& cache) {
+		auto it = cache.monomials.find(m);
+		if (it != cache.monomials.end()) return it->second;
+		std::uint32_t res = 0;
+		bool first = true;
+		for (const auto& [var, exp]: m->exponents()) {
+			auto slot = static_cast<std::uint32_t>(std::lower_bound(mVariables.begin(), mVariables.end(), var) - mVariables.begin());
+			std::uint32_t p = power(slot, exp, cache);
+			if (first) {
+				res = p;
+				first = false;
+			} else {
+				std::uint32_t prod = new_register();
+				emit(Op::Mul, prod, res, p);
+				res = prod;
+			}
+		}
+		cache.monomials.emplace(m, res);
+		return res;
+	}
+	template<typename C, typename C2, typename O, typename P>
+	std::uint32_t compile(const MultivariatePolynomial<C2,O,P>& p, C& cache) {
+		std::uint32_t res = new_register();
+		emit(Op::Const, res, constant(p.constantPart(), cache));
+		for (const auto& t: p) {
+			if (t.isConstant()) continue;
+			std::uint32_t m = monomial(t.monomial(), cache);
+			if (carl::isOne(t.coeff())) {
+				emit(Op::Add, res, m);
+			} else {
+				emit(Op::AddMul, res, constant(t.coeff(), cache), m);
+			}
+		}
+		return res;
+	}
+	template<typename C, typename P>
+	std::uint32_t compile(const FactorizedPolynomial<P>& p, C& cache) {
+		if (!existsFactorization(p)) {
+			std::uint32_t res = new_register();
+			emit(Op::Const, res, constant(p.coefficient(), cache));
+			return res;
+		}
+		std::vector<std::uint32_t> factors;
+		if (p.factorizedTrivially()) {
+			factors.emplace_back(compile(p.polynomial(), cache));
+		} else {
+			for (const auto& [factor, exp]: p.factorization()) {
+				auto it = cache.factors.find(factor);
+				std::uint32_t f;
+				if (it != cache.factors.end()) {
+					f = it->second;
+				} else {
+					f = compile(factor, cache);
+					cache.factors.emplace(factor, f);
+				}
+				factors.emplace_back(power(f, exp, cache));
+			}
+		}
+		std::uint32_t res = new_register();
+		emit(Op::Const, res, constant(p.coefficient(), cache));
+		for (std::uint32_t f: factors) {
+			emit(Op::Mul, res, res, f);
+		}
+		return res;
+	}
+
+	/// Runs the program on a single point, the variable registers must already be set.
+	template<typename T>
+	void run(std::vector<T>& registers, const std::vector<T>& constants) const {
+		for (const auto& i: mProgram) {
+			switch (i.op) {
+				case Op::Const: registers[i.target] = constants[i.a]; break;
+				case Op::Add: registers[i.target] += registers[i.a]; break;
+				case Op::AddMul: registers[i.target] += constants[i.a] * registers[i.b]; break;
+				case Op::Mul: registers[i.target] = registers[i.a] * registers[i.b]; break;
+				case Op::Div:
+					assert(!carl::isZero(registers[i.b]));
+					registers[i.target] = registers[i.a] / registers[i.b];
+					break;
+			}
+		}
+	}
+
+	/// Runs the program on a block of points, the variable registers must already be set.
+	void run_block(std::vector<std::array<double, block_size>>& registers, std::size_t count) const {
+		for (const auto& i: mProgram) {
+			auto& t = registers[i.target];
+			switch (i.op) {
+				case Op::Const: {
+					double c = mDoubleConstants[i.a];
+					for (std::size_t l = 0; l < count; ++l) t[l] = c;
+					break;
+				}
+				case Op::Add: {
+					const auto& a = registers[i.a];
+					for (std::size_t l = 0; l < count; ++l) t[l] += a[l];
+					break;
+				}
+				case Op::AddMul: {
+					double c = mDoubleConstants[i.a];
+					const auto& b = registers[i.b];
+					for (std::size_t l = 0; l < count; ++l) t[l] += c * b[l];
+					break;
+				}
+				case Op::Mul: {
+					const auto& a = registers[i.a];
+					const auto& b = registers[i.b];
+					for (std::size_t l = 0; l < count; ++l) t[l] = a[l] * b[l];
+					break;
+				}
+				case Op::Div: {
+					const auto& a = registers[i.a];
+					const auto& b = registers[i.b];
+					for (std::size_t l = 0; l < count; ++l) t[l] = a[l] / b[l];
+					break;
+				}
+			}
+		}
+	}
+
+	void evaluate_range(const std::vector<double>& points, std::vector<double>& results, std::size_t begin, std::size_t end) const {
+		std::vector<std::array<double, block_size>> registers(mRegisters);
+		for (std::size_t start = begin; start < end; start += block_size) {
+			std::size_t count = std::min(block_size, end - start);
+			for (std::size_t l = 0; l < count; ++l) {
+				for (std::size_t v = 0; v < mVariables.size(); ++v) {
+					registers[v][l] = points[(start + l) * mVariables.size() + v];
+				}
+			}
+			run_block(registers, count);
+			std::copy(registers[mResult].begin(), registers[mResult].begin() + static_cast<std::ptrdiff_t>(count), results.begin() + static_cast<std::ptrdiff_t>(start));
+		}
+	}
+
+	void evaluate_range(const std::vector<Number>& points, std::vector<Number>& results, std::size_t begin, std::size_t end) const {
+		std::vector<Number> registers(mRegisters);
+		for (std::size_t p = begin; p < end; ++p) {
+			std::copy(points.begin() + static_cast<std::ptrdiff_t>(p * mVariables.size()), points.begin() + static_cast<std::ptrdiff_t>((p + 1) * mVariables.size()), registers.begin());
+			run(registers, mConstants);
+			results[p] = registers[mResult];
+		}
+	}
+
+	/// Splits the points into contiguous ranges that are evaluated by the given number of threads.
+	template<typename T>
+	void evaluate_parallel(const std::vector<T>& points, std::vector<T>& results, std::size_t threads) const {
+		assert(mVariables.empty() || points.size() % mVariables.size() == 0);
+		std::size_t count = mVariables.empty() ? results.size() : points.size() / mVariables.size();
+		results.resize(count);
+		threads = std::max(std::size_t(1), std::min(threads, count / block_size));
+		if (threads == 1) {
+			evaluate_range(points, results, 0, count);
+			return;
+		}
+		std::size_t chunk = (count + threads - 1) / threads;
+		std::vector<std::thread> workers;
+		for (std::size_t begin = 0; begin < count; begin += chunk) {
+			std::size_t end = std::min(count, begin + chunk);
+			workers.emplace_back([this, &points, &results, begin, end](){ evaluate_range(points, results, begin, end); });
+		}
+		for (auto& w: workers) {
+			w.join();
+		}
+	}
+
+public:
+	template<typename Pol, bool AutoSimplify>
+	explicit CompiledRationalFunction(const RationalFunction<Pol, AutoSimplify>& rf) {
+		if (rf.isConstant()) {
+			Cache<Pol> cache;
+			mResult = new_register();
+			emit(Op::Const, mResult, constant(rf.constantPart(), cache));
+			return;
+		}
+		auto vars = rf.gatherVariables();
+		mVariables.assign(vars.begin(), vars.end());
+		mRegisters = mVariables.size();
+		Cache<Pol> cache;
+		std::uint32_t num = compile(rf.nominatorAsPolynomial(), cache);
+		std::uint32_t den = compile(rf.denominatorAsPolynomial(), cache);
+		mResult = new_register();
+		emit(Op::Div, mResult, num, den);
+	}
+
+	/// The variables in the order in which their values are expected.
+	const std::vector<Variable>& variables() const {
+		return mVariables;
+	}
+	/// The number of instructions of the program.
+	std::size_t size() const {
+		return mProgram.size();
+	}
+
+	/**
+	 * Evaluates the rational function at a single point.
+	 * @tparam T Either double or Number.
+	 * @param point The values of the variables in the order of variables().
+	 */
+	template<typename T>
+	T evaluate(const std::vector<T>& point) const {
+		static_assert(std::is_same<T, double>::value || std::is_same<T, Number>::value, "Points are evaluated either in double or in Number.");
+		assert(point.size() == mVariables.size());
+		std::vector<T> registers(mRegisters);
+		std::copy(point.begin(), point.end(), registers.begin());
+		if constexpr (std::is_same<T, double>::value) {
+			run(registers, mDoubleConstants);
+		} else {
+			run(registers, mConstants);
+		}
+		return registers[mResult];
+	}
+
+	/**
+	 * Evaluates the rational function at a single point.
+	 * @param substitutions A value for every variable of the rational function.
+	 */
+	Number evaluate(const std::map<Variable, Number>& substitutions) const {
+		std::vector<Number> point;
+		for (Variable v: mVariables) {
+			assert(substitutions.find(v) != substitutions.end());
+			point.emplace_back(substitutions.at(v));
+		}
+		return evaluate(point);
+	}
+
+	/**
+	 * Evaluates the rational function in double precision at many points.
+	 * @param points The values of the variables for all points, one point after another.
+	 * @param results Is resized to the number of points and holds the results.
+	 * If the rational function has no variables, the number of points is the size of results.
+	 * @param threads The maximum number of threads, each thread evaluates a contiguous range of points.
+	 */
+	void evaluate_batch(const std::vector<double>& points, std::vector<double>& results, std::size_t threads = 1) const {
+		evaluate_parallel(points, results, threads);
+	}
+
+	/**
+	 * Evaluates the rational function exactly at many points.
+	 * @param points The values of the variables for all points, one point after another.
+	 * @param results Is resized to the number of points and holds the results.
+	 * If the rational function has no variables, the number of points is the size of results.
+	 * @param threads The maximum number of threads, each thread evaluates a contiguous range of points.
+	 */
+	void evaluate_batch(const std::vector<Number>& points, std::vector<Number>& results, std::size_t threads = 1) const {
+		evaluate_parallel(points, results, threads);
+	}
+};
+
+template<typename Pol, bool AutoSimplify>
+CompiledRationalFunction(const RationalFunction<Pol, AutoSimplify>&) -> CompiledRationalFunction<typename Pol::CoeffType>;
+
+}
@@ -3,6 +3,7 @@
 #include "LogLevel.h"
 
 #include <cassert>
+#include <functional>
 #include <iostream>
 #include <map>
 #include <string>
@@ -17,7 +18,16 @@ class Filter {
 	std::map<std::string, LogLevel> mData = {
 		std::make_pair(std::string(""), LogLevel::LVL_DEFAULT)
 	};
+	/// Called whenever a rule changes.
+	std::function<void()> mOnChange;
 public:
+	/**
+	 * Sets a function that is called whenever a rule changes.
+	 * @param onChange Callback.
+	 */
+	void onChange(std::function<void()> onChange) {
+		mOnChange = std::move(onChange);
+	}
 	/**
 	 * Returns the internal filter data.
 	 */
@@ -33,15 +43,15 @@ public:
 	 */
 	Filter& operator()(const std::string& channel, LogLevel level) {
 		mData[channel] = level;
+		if (mOnChange) mOnChange();
 		return *this;
 	}
 	/**
-	 * Checks if the given log level is sufficient for the log message to be forwarded.
+	 * Returns the minimum log level for the given channel, taken from the rule for the channel or its closest parent.
 	 * @param channel Channel name.
-	 * @param level LogLevel.
-	 * @return If the message shall be forwarded.
+	 * @return Minimum LogLevel.
 	 */
-	bool check(const std::string& channel, LogLevel level) const noexcept {
+	LogLevel level(const std::string& channel) const noexcept {
 		auto tmp = channel;
 		auto it = mData.find(tmp);
 		while (!tmp.empty() && it == mData.end()) {
@@ -51,10 +61,18 @@ public:
 		}
 		if (it == mData.end()) {
 			std::cout << "Did not find something for \"" << channel << "\"" << std::endl;
-			return true;
+			return LogLevel::LVL_ALL;
 		}
-		assert(it != mData.end());
-		return level >= it->second;
+		return it->second;
+	}
+	/**
+	 * Checks if the given log level is sufficient for the log message to be forwarded.
+	 * @param channel Channel name.
+	 * @param level LogLevel.
+	 * @return If the message shall be forwarded.
+	 */
+	bool check(const std::string& channel, LogLevel level) const noexcept {
+		return level >= this->level(channel);
 	}
 	/**
 	 * Streaming operator for a Filter.
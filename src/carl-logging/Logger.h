@@ -16,6 +16,7 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <sstream>
 #include <utility>
 
@@ -45,6 +46,8 @@ namespace carl {
  * Usually, it adds auxiliary information like the current time, LogLevel, Channel and information from a RecordInfo to the string logged by the user.
  * The Formatter implements a reasonable default behaviour for log files, but it can be subclassed and modified as necessary.
  * 
+ * Sinks can be wrapped in an AsyncSink, such that the output is written by a background thread.
+ * 
  * The Logger class finally plugs all these components together.
  * It allows to configure multiple Sink objects which are identified by strings called `id` and offers a central `log()` method.
  * 
@@ -65,6 +68,9 @@ namespace carl {
  * <li>`CARLLOG_ASSERT(channel, condition, msg)` checks the condition and if it fails calls `CARLLOG_FATAL(channel, msg)` and asserts the condition.</li>
  * </ul>
  * Any message (`msg` or `args`) can be an arbitrary expression that one would stream to an `std::ostream` like `stream << (msg);`. No final newline is needed.
+ * 
+ * The macros intern their channel once per call site (see channel_id()), and the Logger keeps the minimum visible LogLevel of every interned channel up to date.
+ * Hence checking whether a message is visible does neither construct a string nor inspect the filters.
  */
 namespace logging {
 
@@ -75,8 +81,34 @@ class Logger: public carl::Singleton<Logger> {
 	friend carl::Singleton<Logger>;
 	/// Mapping from channels to associated logging classes.
 	std::map<std::string, std::tuple<std::shared_ptr<Sink>, Filter, std::shared_ptr<Formatter>>> mData;
-	/// Logging mutex to ensure thread-safe logging.
-	std::mutex mMutex;
+	/// Logging mutex, held shared while logging and exclusively while changing the sinks.
+	std::shared_mutex mMutex;
+	/// Interned channels.
+	std::map<std::string, std::unique_ptr<Channel>> mChannels;
+	/// Mutex for the interned channels.
+	std::mutex mChannelMutex;
+
+	/**
+	 * Computes the minimum log level of the given channel over all sinks.
+	 * @param channel Channel name.
+	 */
+	LogLevel minimumLevel(const std::string& channel) const noexcept {
+		LogLevel res = LogLevel::LVL_OFF;
+		for (const auto& t: mData) {
+			res = std::min(res, std::get<1>(t.second).level(channel));
+		}
+		return res;
+	}
+	/**
+	 * Updates the minimum log levels of all interned channels.
+	 */
+	void updateLevels() noexcept {
+		std::lock_guard<std::mutex> lock(mChannelMutex);
+		std::shared_lock<std::shared_mutex> dataLock(mMutex);
+		for (auto& c: mChannels) {
+			c.second->level.store(minimumLevel(c.first), std::memory_order_relaxed);
+		}
+	}
 
 public:
 	/**
@@ -94,8 +126,12 @@ public:
 	 * @param sink Sink.
 	 */
 	void configure(const std::string& id, std::shared_ptr<Sink> sink) {
-		std::lock_guard<std::mutex> lock(mMutex);
-		mData[id] = std::make_tuple(std::move(sink), Filter(), std::make_shared<Formatter>());
+		{
+			std::unique_lock<std::shared_mutex> lock(mMutex);
+			mData[id] = std::make_tuple(std::move(sink), Filter(), std::make_shared<Formatter>());
+			std::get<1>(mData[id]).onChange([this](){ updateLevels(); });
+		}
+		updateLevels();
 	}
 	/**
 	 * Installs a FileSink.
@@ -113,6 +149,18 @@ public:
 	void configure(const std::string& id, std::ostream& os) {
 		configure(id, std::make_shared<StreamSink>(os));
 	}
+	/**
+	 * Removes the Sink with the given id, if present.
+	 * This must be done before a stream used by a StreamSink is destroyed.
+	 * @param id Sink identifier.
+	 */
+	void remove(const std::string& id) {
+		{
+			std::unique_lock<std::shared_mutex> lock(mMutex);
+			mData.erase(id);
+		}
+		updateLevels();
+	}
 	/**
 	 * Retrieves the Filter for some Sink.
 	 * @param id Sink identifier.
@@ -153,6 +201,21 @@ public:
 			std::get<2>(t.second)->configure(std::get<1>(t.second));
 		}
 	}
+	/**
+	 * Returns the interned channel with the given name.
+	 * @param name Channel name.
+	 */
+	ChannelId channel(const std::string& name) noexcept {
+		std::lock_guard<std::mutex> lock(mChannelMutex);
+		auto it = mChannels.find(name);
+		if (it == mChannels.end()) {
+			std::shared_lock<std::shared_mutex> dataLock(mMutex);
+			it = mChannels.emplace(name, std::make_unique<Channel>()).first;
+			it->second->name = name;
+			it->second->level.store(minimumLevel(name), std::memory_order_relaxed);
+		}
+		return it->second.get();
+	}
 	/**
 	 * Checks whether a log message would be visible for some sink.
 	 * If this is not the case, we do not need to render it at all.
@@ -175,12 +238,15 @@ public:
 	 * @param info Auxiliary information.
 	 */
 	void log(LogLevel level, const std::string& channel, const std::stringstream& ss, const RecordInfo& info) {
-		std::lock_guard<std::mutex> lock(mMutex);
+		std::shared_lock<std::shared_mutex> lock(mMutex);
+		std::string message = ss.str();
 		for (auto& t: mData) {
 			if (!std::get<1>(t.second).check(channel, level)) continue;
-			std::get<2>(t.second)->prefix(std::get<0>(t.second)->log(), channel, level, info);
-			std::get<0>(t.second)->log() << ss.str();
-			std::get<2>(t.second)->suffix(std::get<0>(t.second)->log());
+			std::stringstream record;
+			std::get<2>(t.second)->prefix(record, channel, level, info);
+			record << message;
+			std::get<2>(t.second)->suffix(record);
+			std::get<0>(t.second)->write(record.str());
 		}
 	}
 };
@@ -1,7 +1,14 @@
 #pragma once
 
+#include <algorithm>
+#include <condition_variable>
 #include <fstream>
+#include <memory>
+#include <mutex>
 #include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
 
 namespace carl::logging {
 
@@ -9,13 +16,24 @@ namespace carl::logging {
  * Base class for a logging sink. It only provides an interface to access some std::ostream.
  */
 class Sink {
+	/// Mutex to serialize writing records.
+	std::mutex mMutex;
 public:
+	virtual ~Sink() = default;
 	/**
 	 * Abstract logging interface.
 	 * The intended usage is to write any log output to the output stream returned by this function.
 	 * @return Output stream.
 	 */
 	virtual std::ostream& log() noexcept = 0;
+	/**
+	 * Writes a completely formatted log record.
+	 * @param record Log record.
+	 */
+	virtual void write(const std::string& record) {
+		std::lock_guard<std::mutex> lock(mMutex);
+		log() << record << std::flush;
+	}
 };
 /**
  * Logging sink that wraps an arbitrary `std::ostream`.
@@ -49,4 +67,85 @@ public:
 	std::ostream& log() noexcept override { return os; }
 };
 
-}
\ No newline at end of file
+/**
+ * Logging sink that writes records to another sink from a background thread.
+ * Records are stored in a bounded ring buffer, hence logging only waits for the output if the buffer is full.
+ */
+class AsyncSink final: public Sink {
+	/// Sink that eventually writes the records.
+	std::shared_ptr<Sink> mSink;
+	/// Ring buffer of records.
+	std::vector<std::string> mBuffer;
+	/// Position of the oldest record in mBuffer.
+	std::size_t mHead = 0;
+	/// Number of records in mBuffer.
+	std::size_t mSize = 0;
+	/// Number of records that have not yet been written by mSink.
+	std::size_t mPending = 0;
+	/// Whether the background thread shall terminate.
+	bool mStop = false;
+	/// Mutex for the buffer.
+	std::mutex mBufferMutex;
+	std::condition_variable mNotEmpty;
+	std::condition_variable mNotFull;
+	std::condition_variable mDrained;
+	/// Background thread writing the records.
+	std::thread mThread;
+
+	void run() {
+		std::unique_lock<std::mutex> lock(mBufferMutex);
+		while (true) {
+			mNotEmpty.wait(lock, [this](){ return mSize > 0 || mStop; });
+			if (mSize == 0) return;
+			std::string record = std::move(mBuffer[mHead]);
+			mHead = (mHead + 1) % mBuffer.size();
+			--mSize;
+			mNotFull.notify_one();
+			lock.unlock();
+			mSink->write(record);
+			lock.lock();
+			if (--mPending == 0) mDrained.notify_all();
+		}
+	}
+public:
+	/**
+	 * Create an AsyncSink that forwards to the given sink.
+	 * @param sink Sink that writes the records.
+	 * @param capacity Maximum number of buffered records.
+	 */
+	explicit AsyncSink(std::shared_ptr<Sink> sink, std::size_t capacity = 4096):
+		mSink(std::move(sink)), mBuffer(std::max(capacity, std::size_t(1)))
+	{
+		mThread = std::thread([this](){ run(); });
+	}
+	~AsyncSink() override {
+		{
+			std::lock_guard<std::mutex> lock(mBufferMutex);
+			mStop = true;
+		}
+		mNotEmpty.notify_one();
+		mThread.join();
+	}
+	/**
+	 * Gives direct access to the underlying sink, bypassing the buffer.
+	 */
+	std::ostream& log() noexcept override { return mSink->log(); }
+	void write(const std::string& record) override {
+		std::unique_lock<std::mutex> lock(mBufferMutex);
+		mNotFull.wait(lock, [this](){ return mSize < mBuffer.size(); });
+		mBuffer[(mHead + mSize) % mBuffer.size()] = record;
+		++mSize;
+		++mPending;
+		lock.unlock();
+		mNotEmpty.notify_one();
+	}
+	/**
+	 * Waits until all buffered records have been written.
+	 */
+	void flush() {
+		std::unique_lock<std::mutex> lock(mBufferMutex);
+		mDrained.wait(lock, [this](){ return mPending == 0; });
+	}
+};
+
+}
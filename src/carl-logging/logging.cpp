@@ -4,6 +4,10 @@
 
 namespace carl::logging {
 
+ChannelId channel_id(const std::string& channel) noexcept {
+	return Logger::getInstance().channel(channel);
+}
+
 bool visible(LogLevel level, const std::string& channel) noexcept {
 	return Logger::getInstance().visible(level, channel);
 }
@@ -12,4 +16,8 @@ void log(LogLevel level, const std::string& channel, const std::stringstream& ss
 	Logger::getInstance().log(level, channel, ss, info);
 }
 
+void log(LogLevel level, ChannelId channel, const std::stringstream& ss, const RecordInfo& info) {
+	Logger::getInstance().log(level, channel->name, ss, info);
+}
+
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "LogLevel.h"
 
+#include <atomic>
 #include <sstream>
 #include <string>
 
@@ -19,8 +20,35 @@ struct RecordInfo {
 	std::size_t line;
 };
 
+/**
+ * A channel that has been interned by channel_id().
+ * It caches the minimum log level that is visible for any sink, which is updated whenever the sinks or filters change.
+ */
+struct Channel {
+	/// Channel name.
+	std::string name;
+	/// Minimum log level that is forwarded to some sink.
+	std::atomic<LogLevel> level;
+};
+/// Identifies an interned channel. Channels are never deleted, hence the identifier stays valid.
+using ChannelId = const Channel*;
+
+/**
+ * Returns the identifier of the given channel, interning it if necessary.
+ * The log macros call this once per call site.
+ */
+ChannelId channel_id(const std::string& channel) noexcept;
+
 bool visible(LogLevel level, const std::string& channel) noexcept;
+/**
+ * Checks whether a log message of the given channel would be visible for some sink.
+ * This is a single atomic load, hence it is cheap enough for hot code.
+ */
+inline bool visible(LogLevel level, ChannelId channel) noexcept {
+	return level >= channel->level.load(std::memory_order_relaxed);
+}
 void log(LogLevel level, const std::string& channel, const std::stringstream& ss, const RecordInfo& info);
+void log(LogLevel level, ChannelId channel, const std::stringstream& ss, const RecordInfo& info);
 
 }
 
@@ -32,16 +60,18 @@ void log(LogLevel level, const std::string& channel, const std::stringstream& ss
 #define __CARL_LOG_RECORD ::carl::logging::RecordInfo{__FILE__, __func__, __LINE__}
 /// Create a record info without function name.
 #define __CARL_LOG_RECORD_NOFUNC ::carl::logging::RecordInfo{__FILE__, "", __LINE__}
-/// Basic logging macro.
+/// Basic logging macro. The channel is interned once per call site, hence it must be the same whenever this call site is executed.
 #define __CARL_LOG(level, channel, expr) { \
-	if (::carl::logging::visible(level, channel)) { \
-		std::stringstream __ss; __ss << expr; ::carl::logging::log(level, channel, __ss, __CARL_LOG_RECORD); \
+	static const ::carl::logging::ChannelId __channel_id = ::carl::logging::channel_id(channel); \
+	if (::carl::logging::visible(level, __channel_id)) { \
+		std::stringstream __ss; __ss << expr; ::carl::logging::log(level, __channel_id, __ss, __CARL_LOG_RECORD); \
 	}}
 
 /// Basic logging macro without function name.
 #define __CARL_LOG_NOFUNC(level, channel, expr) { \
-	if (::carl::logging::visible(level, channel)) { \
-		std::stringstream __ss; __ss << expr; ::carl::logging::log(level, channel, __ss, __CARL_LOG_RECORD_NOFUNC); \
+	static const ::carl::logging::ChannelId __channel_id = ::carl::logging::channel_id(channel); \
+	if (::carl::logging::visible(level, __channel_id)) { \
+		std::stringstream __ss; __ss << expr; ::carl::logging::log(level, __channel_id, __ss, __CARL_LOG_RECORD_NOFUNC); \
 	}}
 
 /// Intended to be called when entering a function. Format: `<function name>(<args>)`.
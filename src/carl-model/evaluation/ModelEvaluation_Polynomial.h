@@ -45,20 +45,44 @@ namespace model {
 		p.substituteIn(var, r);
 	}
 
+	/**
+	 * Substitutes many variables with rationals within a polynomial in a single pass.
+	 */
+	template<typename Rational>
+	void substituteIn(MultivariatePolynomial<Rational>& p, const std::map<Variable, Rational>& values) {
+		carl::substitute_inplace(p, values);
+	}
+	template<typename Poly, typename Rational>
+	void substituteIn(UnivariatePolynomial<Poly>& p, const std::map<Variable, Rational>& values) {
+		if (values.empty()) return;
+		if (values.find(p.mainVar()) != values.end()) {
+			Poly tmp(p);
+			carl::substitute_inplace(tmp, values);
+			p = carl::to_univariate_polynomial(tmp, p.mainVar());
+			return;
+		}
+		for (auto& c: p.coefficients()) {
+			carl::substitute_inplace(c, values);
+		}
+		p.stripLeadingZeroes();
+	}
+
 	/**
 	 * Substitutes all variables from a model within a polynomial.
+	 * Rationals and numeric real algebraic numbers are collected and substituted in a single pass at the end.
 	 * May fail to substitute some variables, for example if the values are RANs or SqrtEx.
 	 */
 	template<typename Rational, typename Poly, typename ModelPoly>
 	void substituteIn(Poly& p, const Model<Rational,ModelPoly>& m) {
+		std::map<Variable, Rational> values;
 		for (auto var: carl::variables(p).underlyingVariables()) {
 			auto it = m.find(var);
 			if (it == m.end()) continue;
 			const ModelValue<Rational,ModelPoly>& value = m.evaluated(var);
 			if (value.isRational()) {
-				substituteIn(p, var, value.asRational());
+				values.emplace(var, value.asRational());
 			} else if (value.isRAN()) {
-				substituteIn(p, var, value.asRAN());
+				if (value.asRAN().is_numeric()) values.emplace(var, value.asRAN().value());
 			} else if (value.isSubstitution()) {
 				const auto& subs = value.asSubstitution();
 				auto polysub = dynamic_cast<const ModelPolynomialSubstitution<Rational,Poly>*>(subs.get());
@@ -67,6 +91,7 @@ namespace model {
 				}
 			}
 		}
+		substituteIn(p, values);
 	}
 	
 	/**
@@ -4,6 +4,7 @@
 #include "Timing.h"
 
 #include <map>
+#include <type_traits>
 #include <sstream>
 #include <algorithm>
 #include <assert.h>
@@ -27,9 +28,20 @@ protected:
 		if constexpr(std::is_same<T,std::string>::value) {
 			assert(!has_illegal_chars(static_cast<std::string>(value)) && "spaces, (, ) are not allowed here");
 			mCollected.emplace(key, value);
-		} else if constexpr(std::is_same<T,timer>::value) {
-			mCollected.emplace(key+"_count", std::to_string(static_cast<timer>(value).count()));
-			mCollected.emplace(key+"_overall_ms", std::to_string(static_cast<timer>(value).overall_ms()));
+		} else if constexpr(std::is_base_of<timer,T>::value) {
+			mCollected.emplace(key+"_count", std::to_string(value.count()));
+			mCollected.emplace(key+"_overall_ms", std::to_string(value.overall_ms()));
+			mCollected.emplace(key+"_overall_ns", std::to_string(value.overall_ns()));
+			mCollected.emplace(key+"_mean_ns", std::to_string(value.mean_ns()));
+			if constexpr(std::is_base_of<histogram_timer,T>::value) {
+				addKeyValuePair(key, value.histogram());
+			}
+		} else if constexpr(std::is_same<T,histogram>::value) {
+			mCollected.emplace(key+"_min_ns", std::to_string(value.min_ns()));
+			mCollected.emplace(key+"_p50_ns", std::to_string(value.percentile_ns(50)));
+			mCollected.emplace(key+"_p90_ns", std::to_string(value.percentile_ns(90)));
+			mCollected.emplace(key+"_p99_ns", std::to_string(value.percentile_ns(99)));
+			mCollected.emplace(key+"_max_ns", std::to_string(value.max_ns()));
 		} else {
 			std::stringstream ss;
 			ss << value;
@@ -1,15 +1,19 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <chrono>
+#include <cstdint>
+#include <limits>
 
 namespace carl {
 namespace statistics {
 
 namespace timing {
-    /// The clock type used here.
-    using clock = std::chrono::high_resolution_clock;
+    /// The clock type used here. It is monotonic and usually read without a system call.
+    using clock = std::chrono::steady_clock;
     /// The duration type used here.
-    using duration = std::chrono::duration<std::size_t,std::milli>;
+    using duration = std::chrono::nanoseconds;
     /// The type of a time point.
     using time_point = clock::time_point;
 
@@ -27,6 +31,9 @@ namespace timing {
     }
 }
 
+/**
+ * Accumulates the number of timed events and the overall time in nanoseconds.
+ */
 class timer {
     std::size_t m_count = 0;
     timing::duration m_overall = timing::zero();
@@ -36,16 +43,108 @@ public:
 		return timing::now();
 	}
     void finish(timing::time_point start) {
+		add(timing::since(start));
+	}
+    void add(timing::duration d) {
 		++m_count;
-		m_overall += timing::since(start);
+		m_overall += d;
 	}
     auto count() const {
         return m_count;
     }
-    auto overall_ms() const {
-        return m_overall.count();
+    std::size_t overall_ns() const {
+        return static_cast<std::size_t>(m_overall.count());
+    }
+    std::size_t overall_ms() const {
+        return static_cast<std::size_t>(std::chrono::duration_cast<std::chrono::milliseconds>(m_overall).count());
+    }
+    /// Return the average time of an event in nanoseconds.
+    std::size_t mean_ns() const {
+        return m_count == 0 ? 0 : overall_ns() / m_count;
+    }
+};
+
+/**
+ * A histogram of durations with logarithmic buckets.
+ * Bucket i holds durations d with 2^(i-1) <= d < 2^i nanoseconds, bucket 0 holds zero durations.
+ * Percentiles are thus only exact up to a factor of two.
+ */
+class histogram {
+public:
+    static constexpr std::size_t buckets = std::numeric_limits<std::uint64_t>::digits + 1;
+private:
+    std::array<std::size_t, buckets> m_buckets = {};
+    std::size_t m_count = 0;
+    std::uint64_t m_min = std::numeric_limits<std::uint64_t>::max();
+    std::uint64_t m_max = 0;
+
+    static std::size_t bucket(std::uint64_t ns) {
+        std::size_t res = 0;
+        while (ns > 0) {
+            ns >>= 1;
+            ++res;
+        }
+        return res;
+    }
+public:
+    void add(timing::duration d) {
+        auto ns = static_cast<std::uint64_t>(std::max(d.count(), timing::duration::rep(0)));
+        ++m_buckets[bucket(ns)];
+        ++m_count;
+        m_min = std::min(m_min, ns);
+        m_max = std::max(m_max, ns);
+    }
+    auto count() const {
+        return m_count;
+    }
+    const auto& bucket_counts() const {
+        return m_buckets;
+    }
+    std::uint64_t min_ns() const {
+        return m_count == 0 ? 0 : m_min;
+    }
+    std::uint64_t max_ns() const {
+        return m_max;
+    }
+    /**
+     * Return an upper bound for the given percentile in nanoseconds.
+     * @param p Percentile from [0,100].
+     */
+    std::uint64_t percentile_ns(double p) const {
+        if (m_count == 0) return 0;
+        auto rank = static_cast<std::size_t>(p / 100 * static_cast<double>(m_count));
+        rank = std::clamp(rank, std::size_t(1), m_count);
+        std::size_t seen = 0;
+        for (std::size_t i = 0; i < buckets; ++i) {
+            seen += m_buckets[i];
+            if (seen >= rank) {
+                if (i == 0) return 0;
+                std::uint64_t upper = (i == buckets - 1) ? std::numeric_limits<std::uint64_t>::max() : (std::uint64_t(1) << i) - 1;
+                return std::clamp(upper, min_ns(), m_max);
+            }
+        }
+        return m_max;
     }
 };
 
+/**
+ * A timer that additionally records every event in a histogram.
+ * It costs an additional bucket update per event, hence the plain timer should be used unless the distribution is of interest.
+ */
+class histogram_timer: public timer {
+    statistics::histogram m_histogram;
+public:
+    void finish(timing::time_point start) {
+		add(timing::since(start));
+	}
+    void add(timing::duration d) {
+		timer::add(d);
+		m_histogram.add(d);
+	}
+    const auto& histogram() const {
+        return m_histogram;
+    }
+};
+
+}
 }
-}
\ No newline at end of file
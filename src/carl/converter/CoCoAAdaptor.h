@@ -17,6 +17,8 @@
 #include <cstdlib>
 #include <iterator>
 #include <map>
+#include <memory>
+#include <unordered_map>
 
 //#include "CoCoA/library.H"
 #include <CoCoA/BigInt.H>
@@ -45,14 +47,24 @@ namespace cocoawrapper {
 	CoCoA::factorization<CoCoA::RingElem> SqFreeFactor(const CoCoA::RingElem& p);
 }
 
+template<typename Poly>
+class CoCoAAdaptorCache;
+
 template<typename Poly>
 class CoCoAAdaptor {
+	friend class CoCoAAdaptorCache<Poly>;
 private:
 	std::map<Variable, CoCoA::RingElem> mSymbolThere;
 	std::vector<Variable> mSymbolBack;
 	CoCoA::ring mQ = CoCoA::RingQQ();
 	CoCoA::SparsePolyRing mRing;
+	/// Whether conversions to CoCoA are memoized in mConversionCache.
+	bool mCacheConversions = false;
+	mutable std::unordered_map<Poly, CoCoA::RingElem> mConversionCache;
 public:
+	/// Maximum number of memoized conversions, the memo is cleared once it is full.
+	static constexpr std::size_t conversionCacheSize = 1024;
+
 	CoCoA::BigInt convert(const mpz_class& n) const {
 		return CoCoA::BigIntFromMPZ(n.get_mpz_t());
 	}
@@ -108,6 +120,15 @@ public:
 	}
 
 	CoCoA::RingElem convert(const Poly& p) const {
+		auto start = CARL_TIME_START();
+		if (mCacheConversions) {
+			auto it = mConversionCache.find(p);
+			if (it != mConversionCache.end()) {
+				CARL_CALL_STATISTICS(cocoa::statistics().conversionHits++);
+				CARL_TIME_FINISH(cocoa::statistics().conversion, start);
+				return it->second;
+			}
+		}
 		CoCoA::RingElem res(mRing);
 		for (const auto& t: p) {
 			if (!t.monomial()) {
@@ -127,10 +148,18 @@ public:
 			}
 			res += CoCoA::monomial(mRing, convert(t.coeff()), exponents);
 		}
+		if (mCacheConversions) {
+			if (mConversionCache.size() >= conversionCacheSize) {
+				mConversionCache.clear();
+			}
+			mConversionCache.emplace(p, res);
+		}
+		CARL_TIME_FINISH(cocoa::statistics().conversion, start);
 		return res;
 	}
 
 	Poly convert(const CoCoA::RingElem& p) const {
+		auto start = CARL_TIME_START();
 		Poly res;
 		for (CoCoA::SparsePolyIter i = CoCoA::BeginIter(p); !CoCoA::IsEnded(i); ++i) {
 			typename Poly::CoeffType coeff;
@@ -151,6 +180,7 @@ public:
 				res += typename Poly::TermType(std::move(coeff), createMonomial(std::move(monContent), tdeg));
 			}
 		}
+		CARL_TIME_FINISH(cocoa::statistics().conversion, start);
 		return res;
 	}
 
@@ -214,13 +244,16 @@ public:
 		for (std::size_t i = 0; i < mSymbolBack.size(); ++i) {
 			mSymbolThere[mSymbolBack[i]] = indets[i];
 		}
+		mConversionCache.clear();
 	}
 	
 	Poly gcd(const Poly& p1, const Poly& p2) const {
+		auto q1 = convert(p1);
+		auto q2 = convert(p2);
 		auto start = CARL_TIME_START();
-		auto res = convert(cocoawrapper::gcd(convert(p1), convert(p2)));
+		auto res = cocoawrapper::gcd(q1, q2);
 		CARL_TIME_FINISH(cocoa::statistics().gcd, start);
-		return res;
+		return convert(res);
 	}
 
 	Poly makeCoprimeWith(const Poly& p1, const Poly& p2) const {
@@ -243,8 +276,10 @@ public:
 	 * the exponents.
 	 */
 	Factors<Poly> factorize(const Poly& p, bool includeConstant = true) const {
+		auto q = convert(p);
 		auto start = CARL_TIME_START();
-		auto finfo = cocoawrapper::factor(convert(p));
+		auto finfo = cocoawrapper::factor(q);
+		CARL_TIME_FINISH(cocoa::statistics().factorize, start);
 		Factors<Poly> res;
 		if (includeConstant && !CoCoA::IsOne(finfo.myRemainingFactor())) {
 			res.emplace(convert(finfo.myRemainingFactor()), 1);
@@ -252,7 +287,6 @@ public:
 		for (std::size_t i = 0; i < finfo.myFactors().size(); ++i) {
 			res.emplace(convert(finfo.myFactors()[i]), finfo.myMultiplicities()[i]);
 		}
-		CARL_TIME_FINISH(cocoa::statistics().factorize, start);
 		return res;
 	}
 
@@ -308,11 +342,89 @@ public:
 	}
 
 	auto GBasis(const std::vector<Poly>& p) const {
+		auto q = convert(p);
 		auto start = CARL_TIME_START();
-		auto res = convert(cocoawrapper::ReducedGBasis(convert(p)));
+		auto res = cocoawrapper::ReducedGBasis(q);
 		CARL_TIME_FINISH(cocoa::statistics().gbasis, start);
+		return convert(res);
+	}
+};
+
+/**
+ * Keeps CoCoAAdaptor objects alive across calls, such that repeated calls on polynomials over the same variables
+ * neither construct a new ring nor convert the same polynomials again.
+ *
+ * An adaptor can be used for all polynomials whose variables are a subset of the ring variables.
+ * If no cached adaptor fits, the most recently used ring is extended by the new variables as long as it stays
+ * below maxExtendedVariables, otherwise a new ring is added and the least recently used one is dropped.
+ * The cache is thread local, as CoCoA objects must not be shared between threads.
+ */
+template<typename Poly>
+class CoCoAAdaptorCache {
+private:
+	/// Cached adaptors, the most recently used is at the back.
+	std::vector<std::unique_ptr<CoCoAAdaptor<Poly>>> mAdaptors;
+
+	CoCoAAdaptorCache() = default;
+
+	static std::unique_ptr<CoCoAAdaptor<Poly>> create(const std::vector<Variable>& vars) {
+		auto res = std::make_unique<CoCoAAdaptor<Poly>>(vars);
+		res->mCacheConversions = true;
 		return res;
 	}
+public:
+	/// Maximum number of rings kept in the cache.
+	static constexpr std::size_t maxRings = 8;
+	/// Rings are only extended up to this number of variables.
+	static constexpr std::size_t maxExtendedVariables = 16;
+
+	static CoCoAAdaptorCache& getInstance() {
+		static thread_local CoCoAAdaptorCache cache;
+		return cache;
+	}
+
+	/**
+	 * Returns an adaptor whose ring contains all the given variables.
+	 * The reference is only valid until the next call to get() or clear().
+	 */
+	const CoCoAAdaptor<Poly>& get(std::vector<Variable> vars) {
+		std::sort(vars.begin(), vars.end());
+		for (auto it = mAdaptors.rbegin(); it != mAdaptors.rend(); ++it) {
+			const auto& ringVars = (*it)->variables();
+			if (std::includes(ringVars.begin(), ringVars.end(), vars.begin(), vars.end())) {
+				CARL_CALL_STATISTICS(cocoa::statistics().ringHits++);
+				std::rotate(std::prev(it.base()), it.base(), mAdaptors.end());
+				return *mAdaptors.back();
+			}
+		}
+		CARL_CALL_STATISTICS(cocoa::statistics().ringMisses++);
+		if (!mAdaptors.empty()) {
+			const auto& ringVars = mAdaptors.back()->variables();
+			std::vector<Variable> extended;
+			std::set_union(ringVars.begin(), ringVars.end(), vars.begin(), vars.end(), std::back_inserter(extended));
+			if (extended.size() <= maxExtendedVariables) {
+				mAdaptors.back() = create(extended);
+				return *mAdaptors.back();
+			}
+		}
+		if (mAdaptors.size() >= maxRings) {
+			mAdaptors.erase(mAdaptors.begin());
+		}
+		mAdaptors.emplace_back(create(vars));
+		return *mAdaptors.back();
+	}
+
+	/**
+	 * Returns an adaptor whose ring contains all variables of the given polynomials.
+	 */
+	const CoCoAAdaptor<Poly>& get(const std::initializer_list<Poly>& polys) {
+		return get(CoCoAAdaptor<Poly>::variables(std::vector<Poly>(polys)).underlyingVariables());
+	}
+
+	/// Drops all cached rings.
+	void clear() {
+		mAdaptors.clear();
+	}
 };
 
 } // namespace carl
@@ -9,13 +9,22 @@ namespace cocoa {
  
 class CoCoAAdaptorStatistics : public statistics::Statistics {
 public:
-    statistics::timer gcd;
-    statistics::timer factorize;
+    statistics::histogram_timer gcd;
+    statistics::histogram_timer factorize;
     statistics::timer gbasis;
+    /// Time spent converting polynomials from and to CoCoA, not included in the timers above.
+    statistics::timer conversion;
+    std::size_t conversionHits = 0;
+    std::size_t ringHits = 0;
+    std::size_t ringMisses = 0;
     void collect() {
         Statistics::addKeyValuePair("gcd", gcd);
         Statistics::addKeyValuePair("factorize", factorize);
         Statistics::addKeyValuePair("gbasis", gbasis);
+        Statistics::addKeyValuePair("conversion", conversion);
+        Statistics::addKeyValuePair("conversion_hits", conversionHits);
+        Statistics::addKeyValuePair("ring_hits", ringHits);
+        Statistics::addKeyValuePair("ring_misses", ringMisses);
     }
 };
 
@@ -12,18 +12,19 @@ namespace carl
 {
 	Monomial::~Monomial() {
 		CARL_LOG_TRACE("carl.core.monomial", "Freeing " << *this);
-		MonomialPool::getInstance().free(this);
+	}
+	void Monomial::destroy(const Monomial* m) {
+		MonomialPool::getInstance().free(m);
 	}
 	Monomial::Arg Monomial::dropVariable(Variable v) const
 	{
-		///@todo this should work on the shared_ptr directly. Then we could directly return this shared_ptr instead of the ugly copying.
 		CARL_LOG_FUNC("carl.core.monomial", mExponents << ", " << v);
 		auto it = std::find(mExponents.cbegin(), mExponents.cend(), v);
 
 		if (it == mExponents.cend())
 		{
-			std::vector<std::pair<Variable, exponent>> exps(this->mExponents);
-			return MonomialPool::getInstance().create(std::move(exps), mTotalDegree);
+			// The reference count is stored in the monomial, hence we can create a new reference from this.
+			return Monomial::Arg(this);
 		}
 		if (mExponents.size() == 1) return nullptr;
 
@@ -68,7 +69,7 @@ namespace carl
 	bool Monomial::divide(const Monomial::Arg& m, Monomial::Arg& res) const
 	{
 		if (!m) {
-			res = carl::createMonomial(Content(mExponents), mTotalDegree);
+			res = Monomial::Arg(this);
 			CARL_LOG_TRACE("carl.core.monomial", *this << " / " << m << " = " << res);
 			return true;
 		}
@@ -78,6 +79,20 @@ namespace carl
 			CARL_LOG_TRACE("carl.core.monomial", *this << " / " << m << " fails");
 			return false;
 		}
+		if (isPacked() && m->isPacked()) {
+			if (!packedDivisible(mPacked, m->mPacked)) {
+				CARL_LOG_TRACE("carl.core.monomial", *this << " / " << m << " fails");
+				return false;
+			}
+			if (mTotalDegree == m->mTotalDegree) {
+				res = nullptr;
+			} else {
+				// No lane of m is larger than the respective lane of this, hence there are no borrows.
+				res = MonomialPool::getInstance().createPacked({mPacked[0] - m->mPacked[0], mPacked[1] - m->mPacked[1]});
+			}
+			CARL_LOG_TRACE("carl.core.monomial", *this << " / " << m << " = " << res);
+			return true;
+		}
 		Content newExps;
 
 		// Linear, as we expect small monomials.
@@ -148,7 +163,7 @@ namespace carl
 		return createMonomial(std::move(newExps), mTotalDegree / 2);
 	}
 	
-	Monomial::Arg Monomial::lcm(const std::shared_ptr<const Monomial>& lhs, const std::shared_ptr<const Monomial>& rhs)
+	Monomial::Arg Monomial::lcm(const Monomial::Arg& lhs, const Monomial::Arg& rhs)
 	{
 		if (!lhs && !rhs) return nullptr;
 		if (!lhs) return rhs;
@@ -156,6 +171,19 @@ namespace carl
 		CARL_LOG_FUNC("carl.core.monomial", lhs << ", " << rhs);
 		assert(lhs->isConsistent());
 		assert(rhs->isConsistent());
+		if (lhs->isPacked() && rhs->isPacked()) {
+			Packed res;
+			for (std::size_t w = 0; w < res.size(); ++w) {
+				// The highest bit of a lane of mask is set if and only if the lane of lhs is at least the lane of rhs.
+				std::uint64_t mask = ((lhs->mPacked[w] | packed_guard) - rhs->mPacked[w]) & packed_guard;
+				// Extend the highest bit to the whole lane.
+				mask = (mask >> 7) * 0xff;
+				res[w] = (lhs->mPacked[w] & mask) | (rhs->mPacked[w] & ~mask);
+			}
+			Monomial::Arg result = MonomialPool::getInstance().createPacked(res);
+			CARL_LOG_TRACE("carl.core.monomial", "Result: " << result);
+			return result;
+		}
 
 		Content newExps;
 		std::size_t expsum = lhs->tdeg() + rhs->tdeg();
@@ -170,7 +198,7 @@ namespace carl
 			{
 				// Insert remaining part
 				newExps.insert(newExps.end(), itleft, lhs->mExponents.end());
-				std::shared_ptr<const Monomial> result = MonomialPool::getInstance().create( std::move(newExps), expsum );
+				Monomial::Arg result = MonomialPool::getInstance().create( std::move(newExps), expsum );
 				CARL_LOG_TRACE("carl.core.monomial", "Result: " << result);
 				return result;
 			}
@@ -199,7 +227,7 @@ namespace carl
 		}
 		 // Insert remaining part
 		newExps.insert(newExps.end(), itright, rhs->mExponents.end());
-		std::shared_ptr<const Monomial> result = MonomialPool::getInstance().create( std::move(newExps), expsum );
+		Monomial::Arg result = MonomialPool::getInstance().create( std::move(newExps), expsum );
 		CARL_LOG_TRACE("carl.core.monomial", "Result: " << result);
 		return result;
 	}
@@ -233,6 +261,7 @@ namespace carl
 		assert( (&lhs != &rhs) || (lhs.id() == rhs.id()) );
 		assert((lhs.id() != 0) && (rhs.id() != 0));
 		if (lhs.id() == rhs.id()) return CompareResult::EQUAL;
+		if (lhs.isPacked() && rhs.isPacked()) return packedLexicalCompare(lhs.mPacked, rhs.mPacked);
 		auto lhsit = lhs.mExponents.begin();
 		auto rhsit = rhs.mExponents.begin();
 		auto lhsend = lhs.mExponents.end();
@@ -257,6 +286,33 @@ namespace carl
 		return CompareResult::LESS;
 	}
 	
+	CompareResult Monomial::packedLexicalCompare(const Packed& lhs, const Packed& rhs)
+	{
+		for (std::size_t w = 0; w < lhs.size(); ++w) {
+			std::uint64_t diff = lhs[w] ^ rhs[w];
+			if (diff == 0) continue;
+			// The first lane that differs is the most significant byte that differs.
+			auto shift = static_cast<unsigned>(63 - __builtin_clzll(diff)) & ~7U;
+			std::uint64_t l = (lhs[w] >> shift) & packed_max_exponent;
+			std::uint64_t r = (rhs[w] >> shift) & packed_max_exponent;
+			if (l != 0 && r != 0) {
+				return (l > r) ? CompareResult::LESS : CompareResult::GREATER;
+			}
+			// The variable of this lane only occurs in one monomial.
+			// As in lexicalCompare(), the result depends on whether the other monomial has any larger variable.
+			const Packed& other = (l == 0) ? lhs : rhs;
+			bool larger = (other[w] & ((std::uint64_t(1) << shift) - 1)) != 0;
+			for (std::size_t i = w + 1; i < other.size(); ++i) {
+				larger = larger || other[i] != 0;
+			}
+			if (l == 0) {
+				return larger ? CompareResult::GREATER : CompareResult::LESS;
+			}
+			return larger ? CompareResult::LESS : CompareResult::GREATER;
+		}
+		return CompareResult::EQUAL;
+	}
+
 	Monomial::Arg operator*(const Monomial::Arg& lhs, const Monomial::Arg& rhs)
 	{
 		if(!lhs)
@@ -267,6 +323,16 @@ namespace carl
 		assert( lhs->tdeg() > 0 );
 		assert(lhs->isConsistent());
 		assert(rhs->isConsistent());
+		if (lhs->isPacked() && rhs->isPacked()) {
+			Monomial::Packed sum = {lhs->packed()[0] + rhs->packed()[0], lhs->packed()[1] + rhs->packed()[1]};
+			// A lane overflows into its highest bit, but never into the next lane.
+			if (((sum[0] | sum[1]) & Monomial::packed_guard) == 0) {
+				Monomial::Arg result = MonomialPool::getInstance().createPacked(sum);
+				CARL_LOG_TRACE("carl.core.monomial", lhs << " * " << rhs << " = " << result);
+				assert(lhs->tdeg() + rhs->tdeg() == result->tdeg());
+				return result;
+			}
+		}
 		Monomial::Content newExps;
 		newExps.reserve(lhs->exponents().size() + rhs->exponents().size());
 
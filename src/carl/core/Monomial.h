@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "../config.h"
 #include "../util/hash.h"
 #include "CompareResult.h"
 #include "Variable.h"
@@ -14,12 +15,16 @@
 #include "VariablePool.h"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include <list>
 #include <numeric>
 #include <set>
 #include <sstream>
 
 #include <boost/intrusive/unordered_set.hpp>
+#include <boost/smart_ptr/intrusive_ptr.hpp>
 
 
 namespace carl
@@ -52,14 +57,37 @@ namespace carl
 	 * Besides, many operations like multiplication, division or substitution do not rely
 	 * on finding some variable, but must iterate over all entries anyway.
 	 * 
+	 * Additionally, the exponents of a monomial may be stored in a packed form, see Monomial::Packed.
+	 * If both operands are packed, divisibility, comparison, multiplication and the lcm work on a few machine words instead of the pairs.
+	 * 
+	 * Monomials are only created by the MonomialPool, which ensures that every monomial exists only once.
+	 * They are referenced by Monomial::Arg, an intrusive pointer to the reference count stored in the monomial.
+	 * Unless THREAD_SAFE is set, the reference count is a plain integer, hence copying terms does not involve atomic operations.
+	 * 
 	 * @ingroup multirp
 	 */
 	class Monomial final : public boost::intrusive::unordered_set_base_hook<>
 	{
 		friend class MonomialPool;
+		friend void intrusive_ptr_add_ref(const Monomial* m);
+		friend void intrusive_ptr_release(const Monomial* m);
 	public:
-		using Arg = std::shared_ptr<const Monomial>;
+		using Arg = boost::intrusive_ptr<const Monomial>;
 		using Content = std::vector<std::pair<Variable, std::size_t>>;
+		/**
+		 * Packed exponents, every byte of the two words is a lane that holds the exponent of one variable.
+		 * The variables of the lanes are managed by the MonomialPool and are sorted: the first lane is the most significant byte of the first word.
+		 * As the highest bit of every lane is zero, lanes can be added and subtracted word-wise without affecting the neighbouring lanes.
+		 */
+		using Packed = std::array<std::uint64_t, 2>;
+		/// Number of lanes in Packed.
+		static constexpr std::size_t packed_lanes = 16;
+		/// Largest exponent that can be stored in a lane.
+		static constexpr exponent packed_max_exponent = 0x7f;
+		/// Highest bit of every lane.
+		static constexpr std::uint64_t packed_guard = 0x8080808080808080;
+		/// Value of Packed for monomials that are not packed.
+		static constexpr Packed unpacked = {~std::uint64_t(0), ~std::uint64_t(0)};
 		~Monomial();
 
 		/**
@@ -77,11 +105,51 @@ namespace carl
 		mutable std::size_t mId = 0;
 		/// Cached hash.
 		mutable std::size_t mHash = 0;
+		/// Packed exponents, set by the MonomialPool if all variables have a lane.
+		Packed mPacked = unpacked;
 
 		using exponents_it = Content::iterator ;
 		using exponents_cIt = Content::const_iterator;
 
-		mutable std::weak_ptr<const Monomial> mWeakPtr;
+		/// Number of Monomial::Arg referencing this monomial.
+		#ifdef THREAD_SAFE
+		mutable std::atomic<std::size_t> mRefCount{0};
+		#else
+		mutable std::size_t mRefCount = 0;
+		#endif
+
+		/**
+		 * Increments the reference count, unless it is zero.
+		 * A monomial whose reference count dropped to zero is about to be freed and must not be revived.
+		 * @return If the reference count was incremented.
+		 */
+		bool try_add_ref() const {
+			#ifdef THREAD_SAFE
+			std::size_t count = mRefCount.load(std::memory_order_relaxed);
+			while (count != 0) {
+				if (mRefCount.compare_exchange_weak(count, count + 1, std::memory_order_relaxed)) return true;
+			}
+			return false;
+			#else
+			if (mRefCount == 0) return false;
+			++mRefCount;
+			return true;
+			#endif
+		}
+		/// Removes the monomial from the pool and deletes it, called when the last reference is released.
+		static void destroy(const Monomial* m);
+
+		/**
+		 * Checks whether every lane of rhs is at most the respective lane of lhs.
+		 * Setting the highest bit of every lane of lhs before subtracting prevents borrows between lanes,
+		 * and the highest bit of a lane stays set if and only if the lane of lhs is at least the lane of rhs.
+		 */
+		static bool packedDivisible(const Packed& lhs, const Packed& rhs) {
+			return ((((lhs[0] | packed_guard) - rhs[0]) & packed_guard) == packed_guard)
+				&& ((((lhs[1] | packed_guard) - rhs[1]) & packed_guard) == packed_guard);
+		}
+		/// Implements lexicalCompare() on packed exponents.
+		static CompareResult packedLexicalCompare(const Packed& lhs, const Packed& rhs);
 
 		/**
 		 * Calculates the hash and stores it to mHash.
@@ -176,6 +244,21 @@ namespace carl
 		std::size_t id() const {
 			return mId;
 		}
+
+		/**
+		 * Checks whether the exponents of this monomial are packed.
+		 * @return If the exponents are packed.
+		 */
+		bool isPacked() const {
+			return (mPacked[0] & packed_guard) == 0;
+		}
+		/**
+		 * Returns the packed exponents, or Monomial::unpacked if the monomial is not packed.
+		 * @return Packed exponents.
+		 */
+		const Packed& packed() const {
+			return mPacked;
+		}
 		
 		/**
 		 * Gives the total degree, i.e. the sum of all exponents.
@@ -326,6 +409,7 @@ namespace carl
 			assert(isConsistent());
 			if(m->mTotalDegree > mTotalDegree) return false;
 			if(m->nrVariables() > nrVariables()) return false;
+			if(isPacked() && m->isPacked()) return packedDivisible(mPacked, m->mPacked);
 			// Linear, as we expect small monomials.
 			auto itright = m->mExponents.begin();
 			for (const auto& itleft: mExponents) {
@@ -529,12 +613,8 @@ namespace carl
 	 * @return `lhs ~ rhs`, `~` being the relation that is checked.
 	 */
 	inline bool operator==(const Monomial::Arg& lhs, const Monomial::Arg& rhs) {
-		if (lhs.get() == rhs.get()) return true;
-		if (lhs == nullptr || rhs == nullptr) return false;
-		if ((lhs->id() != 0) && (rhs->id() != 0)) return lhs->id() == rhs->id();
-		if (lhs->hash() != rhs->hash()) return false;
-		if (lhs->tdeg() != rhs->tdeg()) return false;
-		return lhs->exponents() == rhs->exponents();
+		// The pool ensures that equal monomials are identical.
+		return lhs.get() == rhs.get();
 	}
 	
 	inline bool operator==(const Monomial::Arg& lhs, Variable rhs) {
@@ -657,8 +737,23 @@ namespace carl
 		}
 		return os;
 	}
+	inline void intrusive_ptr_add_ref(const Monomial* m) {
+		#ifdef THREAD_SAFE
+		m->mRefCount.fetch_add(1, std::memory_order_relaxed);
+		#else
+		++m->mRefCount;
+		#endif
+	}
+	inline void intrusive_ptr_release(const Monomial* m) {
+		#ifdef THREAD_SAFE
+		if (m->mRefCount.fetch_sub(1, std::memory_order_acq_rel) == 1) Monomial::destroy(m);
+		#else
+		if (--m->mRefCount == 0) Monomial::destroy(m);
+		#endif
+	}
+
 	/**
-	 * Streaming operator for std::shared_ptr<Monomial>.
+	 * Streaming operator for Monomial::Arg.
 	 * @param os Output stream.
 	 * @param rhs Monomial.
 	 * @return `os`
@@ -728,8 +823,8 @@ namespace std
 	};
 	
 	/**
-	 * The template specialization of `std::hash` for a shared pointer of a `carl::Monomial`.
-	 * @param monomial The shared pointer to a monomial.
+	 * The template specialization of `std::hash` for a pointer to a `carl::Monomial`.
+	 * @param monomial The pointer to a monomial.
 	 * @return Hash of monomial.
 	 */
 	template<>
@@ -9,23 +9,95 @@
 
 namespace carl {
 
-Monomial::Arg MonomialPool::add(Monomial::Content&& c, exponent totalDegree) {
+std::size_t MonomialPool::lane(Variable v) {
+	std::size_t count = mLaneCount.load(std::memory_order_acquire);
+	if (count == Monomial::packed_lanes) return Monomial::packed_lanes;
+	if (count > 0 && !(mLaneVariables[count - 1] < v)) return Monomial::packed_lanes;
+	if (!mAssignLanes.load(std::memory_order_relaxed)) return Monomial::packed_lanes;
+	#ifdef THREAD_SAFE
+	std::lock_guard<std::mutex> lock(mLaneMutex);
+	#endif
+	// Another thread may have appended lanes in the meantime.
+	count = mLaneCount.load(std::memory_order_relaxed);
+	for (std::size_t i = 0; i < count; ++i) {
+		if (mLaneVariables[i] == v) return i;
+	}
+	if (count == Monomial::packed_lanes) return Monomial::packed_lanes;
+	if (count > 0 && !(mLaneVariables[count - 1] < v)) return Monomial::packed_lanes;
+	CARL_LOG_DEBUG("carl.core.monomial", "Assigning lane " << count << " to " << v);
+	mLaneVariables[count] = v;
+	mLaneCount.store(count + 1, std::memory_order_release);
+	return count;
+}
+
+Monomial::Packed MonomialPool::pack(const Monomial::Content& c) {
+	Monomial::Packed res = {0, 0};
+	std::size_t count = mLaneCount.load(std::memory_order_acquire);
+	std::size_t l = 0;
+	for (const auto& p: c) {
+		if (p.second > Monomial::packed_max_exponent) return Monomial::unpacked;
+		// Both the lanes and the content are sorted.
+		while (l < count && mLaneVariables[l] < p.first) ++l;
+		if (l == count) {
+			l = lane(p.first);
+			if (l == Monomial::packed_lanes) return Monomial::unpacked;
+			count = mLaneCount.load(std::memory_order_acquire);
+		} else if (mLaneVariables[l] != p.first) {
+			return Monomial::unpacked;
+		}
+		res[l / 8] |= std::uint64_t(p.second) << (56 - 8 * (l % 8));
+		++l;
+	}
+	return res;
+}
+
+void MonomialPool::setPackedVariables(std::vector<Variable> vars) {
+	assert(vars.size() <= Monomial::packed_lanes);
+	std::sort(vars.begin(), vars.end());
+	{
+		#ifdef THREAD_SAFE
+		std::lock_guard<std::mutex> lock(mLaneMutex);
+		#endif
+		std::copy(vars.begin(), vars.end(), mLaneVariables.begin());
+		mLaneCount.store(vars.size(), std::memory_order_release);
+		mAssignLanes.store(false, std::memory_order_relaxed);
+	}
+	for (auto& s: mShards) {
+		MONOMIAL_POOL_LOCK_GUARD(s)
+		for (auto& m: s.mSet) {
+			m.mPacked = pack(m.mExponents);
+		}
+	}
+}
+
+Monomial::Arg MonomialPool::add(Monomial::Content&& c, exponent totalDegree, const Monomial::Packed& packed) {
 	CARL_LOG_TRACE("carl.core.monomial", c << ", " << totalDegree);
 
-	MONOMIAL_POOL_LOCK_GUARD
+	std::size_t hash = content_hash()(c);
+	auto& s = shard(hash);
+	MONOMIAL_POOL_LOCK_GUARD(s)
 
 	underlying_set::insert_commit_data insert_data;
-	auto res = mPool.insert_check(c, content_hash(), content_equal(), insert_data);
+	auto res = s.mSet.insert_check(c, [hash](const auto&){ return hash; }, content_equal(), insert_data);
 	if (!res.second) {
-		return res.first->mWeakPtr.lock();
-	} else {
-		auto shared = std::shared_ptr<Monomial>(new Monomial(c, totalDegree));
-		shared.get()->mId = mIDs.get();
-		shared.get()->mWeakPtr = shared;
-		mPool.insert_commit(*shared.get(), insert_data);
-		check_rehash();
-		return shared;
+		if (res.first->try_add_ref()) {
+			// The reference count was already incremented.
+			return Monomial::Arg(&*res.first, false);
+		}
+		// The last reference to the monomial has been released by another thread, but it has not been freed yet.
+		// We unlink it here and make its upcoming call to free() only delete it.
+		CARL_LOG_TRACE("carl.core.monomial", "Replacing expired " << res.first->id());
+		s.freeID(res.first->id());
+		res.first->mId = 0;
+		s.mSet.erase(res.first);
+		s.mSet.insert_check(c, [hash](const auto&){ return hash; }, content_equal(), insert_data);
 	}
+	auto* monomial = new Monomial(std::move(c), totalDegree);
+	monomial->mPacked = (packed == Monomial::unpacked) ? pack(monomial->mExponents) : packed;
+	monomial->mId = s.getID();
+	s.mSet.insert_commit(*monomial, insert_data);
+	s.check_rehash();
+	return Monomial::Arg(monomial);
 }
 
 Monomial::Arg MonomialPool::create(Variable _var, exponent _exp) {
@@ -50,4 +122,22 @@ Monomial::Arg MonomialPool::create(std::vector<std::pair<Variable, exponent>>&&
 	return add(std::move(_exponents), 0);
 }
 
+Monomial::Arg MonomialPool::createPacked(const Monomial::Packed& packed) {
+	assert((packed[0] & Monomial::packed_guard) == 0 && (packed[1] & Monomial::packed_guard) == 0);
+	Monomial::Content exps;
+	exponent tdeg = 0;
+	for (std::size_t w = 0; w < packed.size(); ++w) {
+		// Lanes are ordered from the most significant byte, hence we repeatedly extract the highest nonzero byte.
+		for (std::uint64_t word = packed[w]; word != 0;) {
+			auto shift = static_cast<unsigned>(63 - __builtin_clzll(word)) & ~7U;
+			exponent e = (word >> shift) & Monomial::packed_max_exponent;
+			exps.emplace_back(mLaneVariables[w * 8 + 7 - shift / 8], e);
+			tdeg += e;
+			word &= ~(std::uint64_t(0xff) << shift);
+		}
+	}
+	assert(!exps.empty());
+	return add(std::move(exps), tdeg, packed);
+}
+
 } // end namespace carl
@@ -6,14 +6,17 @@
 #pragma once
 
 #include "../config.h"
-#include "../util/IDPool.h"
 #include "../util/Pool.h"
 #include "../util/Singleton.h"
 #include "Monomial.h"
 #include "config.h"
 
 #include <boost/intrusive/unordered_set.hpp>
+#include <array>
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 namespace carl {
 
@@ -41,39 +44,123 @@ class MonomialPool : public Singleton<MonomialPool> {
 		}
 	};
 
-private:
-	// Members:
-	/// id allocator
-	IDPool mIDs;
-	//size_t mIdAllocator;
-	pool::RehashPolicy mRehashPolicy;
-	using underlying_set = boost::intrusive::unordered_set<Monomial>;
-	std::unique_ptr<underlying_set::bucket_type[]> mPoolBuckets;
-	/// The pool.
-	underlying_set mPool;
-	/// Mutex to avoid multiple access to the pool
-	mutable std::recursive_mutex mMutex;
-
 	#ifdef THREAD_SAFE
-	#define MONOMIAL_POOL_LOCK_GUARD std::lock_guard<std::recursive_mutex> lock(mMutex);
-	#define MONOMIAL_POOL_LOCK mMutex.lock();
-	#define MONOMIAL_POOL_UNLOCK mMutex.unlock();
+	#define MONOMIAL_POOL_LOCK_GUARD(shard) std::lock_guard<std::mutex> lock((shard).mMutex);
 	#else
-	#define MONOMIAL_POOL_LOCK_GUARD
-	#define MONOMIAL_POOL_LOCK
-	#define MONOMIAL_POOL_UNLOCK
+	#define MONOMIAL_POOL_LOCK_GUARD(shard)
 	#endif
 
+	using underlying_set = boost::intrusive::unordered_set<Monomial>;
+
+	/**
+	 * A part of the pool that is responsible for all monomials whose hash maps to this shard.
+	 * Every shard has its own hash set, its own ids and its own lock, hence threads that create different monomials
+	 * usually do not contend with each other.
+	 * The ids are interleaved: the i-th shard hands out the ids i, i + num_shards, i + 2 * num_shards, ...
+	 */
+	struct Shard {
+		pool::RehashPolicy mRehashPolicy;
+		std::unique_ptr<underlying_set::bucket_type[]> mBuckets;
+		/// The monomials of this shard.
+		underlying_set mSet;
+		/// Mutex to avoid multiple access to this shard.
+		mutable std::mutex mMutex;
+		/// Index of this shard within the pool.
+		std::size_t mIndex = 0;
+		/// Ids of freed monomials, they are reused before new ids are handed out.
+		std::vector<std::size_t> mFreeIDs;
+		/// Number of ids handed out so far, including the freed ones.
+		std::size_t mUsedIDs = 0;
+		/// Largest id handed out so far, may be read without holding the lock.
+		std::atomic<std::size_t> mLargestID{0};
+
+		explicit Shard(std::size_t capacity = 64)
+			: mBuckets(new underlying_set::bucket_type[mRehashPolicy.numBucketsFor(capacity)]),
+			  mSet(underlying_set::bucket_traits(mBuckets.get(), mRehashPolicy.numBucketsFor(capacity))) {}
+
+		void check_rehash() {
+			auto rehash = mRehashPolicy.needRehash(mSet.bucket_count(), mSet.size());
+			if (rehash.first) {
+				auto new_buckets = new underlying_set::bucket_type[rehash.second];
+				mSet.rehash(underlying_set::bucket_traits(new_buckets, rehash.second));
+				mBuckets.reset(new_buckets);
+			}
+		}
+
+		/// Returns an unused id, requires the lock.
+		std::size_t getID() {
+			if (!mFreeIDs.empty()) {
+				std::size_t id = mFreeIDs.back();
+				mFreeIDs.pop_back();
+				return id;
+			}
+			std::size_t id = mUsedIDs++ * num_shards + mIndex;
+			mLargestID.store(id, std::memory_order_relaxed);
+			return id;
+		}
+		/// Marks an id of this shard as unused, requires the lock.
+		void freeID(std::size_t id) {
+			assert(id % num_shards == mIndex);
+			mFreeIDs.push_back(id);
+		}
+	};
+
+	/// Number of shards, must be a power of two.
+	static constexpr std::size_t num_shards = 16;
+
+private:
+	// Members:
+	/// The pool, split into independent shards.
+	std::array<Shard, num_shards> mShards;
+	/**
+	 * Variables of the lanes of Monomial::Packed, sorted by the variable order.
+	 * Apart from setPackedVariables(), lanes are only ever appended, hence the first mLaneCount entries never change.
+	 */
+	std::array<Variable, Monomial::packed_lanes> mLaneVariables;
+	/// Number of lanes that have a variable.
+	std::atomic<std::size_t> mLaneCount{0};
+	/// Mutex to avoid multiple threads appending a lane.
+	std::mutex mLaneMutex;
+	/// Whether lanes are assigned to new variables, see setPackedVariables().
+	std::atomic<bool> mAssignLanes{true};
+
+	/**
+	 * Selects the shard responsible for monomials with the given hash.
+	 * We use the upper bits of the hash, as the lower bits select the bucket within the shard.
+	 */
+	Shard& shard(std::size_t hash) {
+		return mShards[(hash >> (sizeof(std::size_t) * 4)) & (num_shards - 1)];
+	}
+
+	/**
+	 * Returns the lane of the given variable.
+	 * If the variable has no lane yet, it is appended if it is larger than all variables that have a lane and there is a free lane.
+	 * @return The lane of v, or Monomial::packed_lanes if v has no lane.
+	 */
+	std::size_t lane(Variable v);
+	/**
+	 * Packs the given exponents, which are required to be sorted.
+	 * @return The packed exponents, or Monomial::unpacked if some variable has no lane or some exponent is too large.
+	 */
+	Monomial::Packed pack(const Monomial::Content& c);
+
 protected:
 	/**
 	 * Constructor of the pool.
 	 * @param _capacity Expected necessary capacity of the pool.
 	 */
-	explicit MonomialPool(std::size_t _capacity = 1000)
-		: mPoolBuckets(new underlying_set::bucket_type[mRehashPolicy.numBucketsFor(_capacity)]),
-		  mPool(underlying_set::bucket_traits(mPoolBuckets.get(), mRehashPolicy.numBucketsFor(_capacity))) {
-		mIDs.get();
-		assert(mIDs.largestID() == 0);
+	explicit MonomialPool(std::size_t _capacity = 1000) {
+		for (std::size_t i = 0; i < num_shards; ++i) {
+			auto& s = mShards[i];
+			s.mIndex = i;
+			auto buckets = s.mRehashPolicy.numBucketsFor(_capacity / num_shards);
+			auto new_buckets = new underlying_set::bucket_type[buckets];
+			s.mSet.rehash(underlying_set::bucket_traits(new_buckets, buckets));
+			s.mBuckets.reset(new_buckets);
+		}
+		// The id zero is reserved for constant terms.
+		[[maybe_unused]] std::size_t zero = mShards[0].getID();
+		assert(zero == 0);
 		VariablePool::getInstance();
 		CARL_LOG_DEBUG("carl.pool", "Monomialpool constructed");
 	}
@@ -83,16 +170,13 @@ protected:
 		// CARL_LOG_DEBUG("carl.pool", "Monomialpool destructed");
 	}
 
-	Monomial::Arg add(Monomial::Content&& c, exponent totalDegree = 0);
-
-	void check_rehash() {
-		auto rehash = mRehashPolicy.needRehash(mPool.bucket_count(), mPool.size());
-		if (rehash.first) {
-			auto new_buckets = new underlying_set::bucket_type[rehash.second];
-			mPool.rehash(underlying_set::bucket_traits(new_buckets, rehash.second));
-			mPoolBuckets.reset(new_buckets);
-		}
-	}
+	/**
+	 * Returns the monomial with the given content, creating it if necessary.
+	 * @param c Content of the monomial.
+	 * @param totalDegree Total degree, or zero.
+	 * @param packed Packed exponents of c, if they are already known.
+	 */
+	Monomial::Arg add(Monomial::Content&& c, exponent totalDegree = 0, const Monomial::Packed& packed = Monomial::unpacked);
 
 public:
 	/**
@@ -134,33 +218,75 @@ public:
 	 */
 	Monomial::Arg create(std::vector<std::pair<Variable, exponent>>&& _exponents);
 
+	/**
+	 * Creates a monomial from packed exponents, as obtained by Monomial::packed().
+	 * 
+	 * @param packed Packed exponents, at least one lane is nonzero.
+	 */
+	Monomial::Arg createPacked(const Monomial::Packed& packed);
+
+	/**
+	 * Selects the variables whose exponents are packed, see Monomial::Packed.
+	 * By default, the lanes are assigned to the variables in the order of their first use,
+	 * as long as every variable is larger than the previous ones and there are free lanes.
+	 * After calling this method, exactly the given variables have a lane, hence an empty list disables packing.
+	 * All existing monomials are packed again, so this must not be called while other threads use monomials.
+	 * @param vars At most Monomial::packed_lanes variables.
+	 */
+	void setPackedVariables(std::vector<Variable> vars);
+	/// Returns the variables that have a lane in Monomial::Packed, in the order of the lanes.
+	std::vector<Variable> packedVariables() const {
+		return std::vector<Variable>(mLaneVariables.begin(), mLaneVariables.begin() + mLaneCount.load(std::memory_order_acquire));
+	}
+
+	/**
+	 * Removes a monomial from the pool and deletes it.
+	 * Is called when the last reference to the monomial is released.
+	 */
 	void free(const Monomial* m) {
 		if (m == nullptr) return;
-		if (m->id() == 0) return;
 		CARL_LOG_TRACE("carl.core.monomial", "Freeing " << m);
-		MONOMIAL_POOL_LOCK_GUARD;
-		auto it = mPool.find(*m);
-		if (it != mPool.end()) {
-			CARL_LOG_TRACE("carl.core.monomial", "Found " << m->id());
-			mIDs.free(m->id());
-			mPool.erase(it);
-		} else {
-			CARL_LOG_TRACE("carl.core.monomial", "Not found in pool.");
+		auto& s = shard(m->hash());
+		{
+			MONOMIAL_POOL_LOCK_GUARD(s)
+			// The id is reset by add() if this monomial has already been replaced after its last reference was released.
+			if (m->id() != 0) {
+				CARL_LOG_TRACE("carl.core.monomial", "Found " << m->id());
+				s.freeID(m->id());
+				s.mSet.erase(s.mSet.iterator_to(const_cast<Monomial&>(*m)));
+			}
 		}
+		delete m;
 	}
 
 	std::size_t size() const {
-		return mPool.size();
+		std::size_t res = 0;
+		for (const auto& s: mShards) {
+			MONOMIAL_POOL_LOCK_GUARD(s)
+			res += s.mSet.size();
+		}
+		return res;
 	}
+	/**
+	 * Returns the largest id handed out so far.
+	 * Does not take any lock, hence ids handed out concurrently may not be reflected.
+	 */
 	std::size_t largestID() const {
-		return mIDs.largestID();
+		std::size_t res = 0;
+		for (const auto& s: mShards) {
+			res = std::max(res, s.mLargestID.load(std::memory_order_relaxed));
+		}
+		return res;
 	}
 };
 
 inline std::ostream& operator<<(std::ostream& os, const MonomialPool& mp) {
 	os << "MonomialPool of size " << mp.size() << std::endl;
-	for (const auto& entry : mp.mPool) {
-		os << "\t" << entry << std::endl;
+	for (const auto& s : mp.mShards) {
+		MONOMIAL_POOL_LOCK_GUARD(s)
+		for (const auto& entry : s.mSet) {
+			os << "\t" << entry << std::endl;
+		}
 	}
 	return os;
 }
@@ -63,8 +63,8 @@ public:
     using PolyType = MultivariatePolynomial<Coeff, Ordering, Policies>;
     /// The type of the cache. Multivariate polynomials do not need a cache, we set it to something.
     using CACHE = std::vector<int>;
-	/// Type our terms vector.f
-	using TermsType = std::vector<Term<Coeff>>;
+	/// Type our terms vector, using the allocator given by the policies.
+	using TermsType = std::vector<Term<Coeff>, typename Policies::template allocator<Term<Coeff>>>;
 	
 	template<typename C, typename T>
 	using EnableIfNotSame = typename std::enable_if<!std::is_same<C,T>::value,T>::type;
@@ -77,8 +77,11 @@ private:
 	/// Flag that indicates if the terms are ordered.
 	mutable bool mOrdered;
 public:
-    ///
-    static TermAdditionManager<MultivariatePolynomial,Ordering> mTermAdditionManager;
+    /// Thread-local manager to collect terms, such that threads do not interfere when constructing polynomials.
+    static TermAdditionManager<MultivariatePolynomial,Ordering>& termAdditionManager() {
+        static thread_local TermAdditionManager<MultivariatePolynomial,Ordering> manager;
+        return manager;
+    }
     
 	enum class ConstructorOperation { ADD, SUB, MUL, DIV };
     friend std::ostream& operator<<(std::ostream& os, ConstructorOperation op) {
@@ -106,7 +109,7 @@ public:
 	explicit MultivariatePolynomial(const Coeff& c);
 	explicit MultivariatePolynomial(Variable::Arg v);
 	explicit MultivariatePolynomial(const Term<Coeff>& t);
-	explicit MultivariatePolynomial(const std::shared_ptr<const Monomial>& m);
+	explicit MultivariatePolynomial(const Monomial::Arg& m);
 	explicit MultivariatePolynomial(const UnivariatePolynomial<MultivariatePolynomial<Coeff, Ordering,Policy>> &pol);
 	explicit MultivariatePolynomial(const UnivariatePolynomial<Coeff>& p);
 	template<class OtherPolicies, DisableIf<std::is_same<Policies,OtherPolicies>> = dummy>
@@ -550,6 +553,23 @@ public:
 	MultivariatePolynomial& operator*=(const Monomial::Arg& rhs);
 	MultivariatePolynomial& operator*=(Variable::Arg rhs);
 	MultivariatePolynomial& operator*=(const Coeff& rhs);
+
+	/**
+	 * Multiplies this polynomial with rhs by merging the term products with a heap (Johnson's algorithm).
+	 * The terms are generated in descending order, such that the result is fully ordered.
+	 * Only min(|this|, |rhs|) term products are stored at any time.
+	 * Called by operator*= if preferHeapMultiplication() holds.
+	 * @param rhs Right hand side.
+	 * @return Changed polynomial.
+	 */
+	MultivariatePolynomial& multiplyHeap(const MultivariatePolynomial& rhs);
+	/**
+	 * Multiplies this polynomial with rhs by collecting all term products in the TermAdditionManager.
+	 * Called by operator*= if preferHeapMultiplication() does not hold.
+	 * @param rhs Right hand side.
+	 * @return Changed polynomial.
+	 */
+	MultivariatePolynomial& multiplyTermAddition(const MultivariatePolynomial& rhs);
 	/// @}
 
 	/// @name In-place division operators
@@ -606,6 +626,14 @@ private:
 	 * @param cterm Iterator to constant term.
 	 */
 	void makeMinimallyOrdered(typename TermsType::iterator& lterm, typename TermsType::iterator& cterm) const;
+	/**
+	 * Checks whether multiplying with rhs should use multiplyHeap().
+	 * This is the case if there are many term products and the result is dense, as defined by the policy.
+	 * The density is estimated by the number of monomials within the degree bounds of the result.
+	 * @param rhs Right hand side.
+	 * @return If the heap should be used.
+	 */
+	bool preferHeapMultiplication(const MultivariatePolynomial& rhs) const;
 
 public:
 	/**
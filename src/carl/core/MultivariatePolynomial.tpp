@@ -17,14 +17,12 @@
 #include <memory>
 #include <mutex>
 #include <list>
+#include <map>
 #include <type_traits>
 
 namespace carl
 {
 
-template<typename Coeff, typename Ordering, typename Policies>
-TermAdditionManager<MultivariatePolynomial<Coeff,Ordering,Policies>,Ordering> MultivariatePolynomial<Coeff,Ordering,Policies>::mTermAdditionManager;
-
 template<typename Coeff, typename Ordering, typename Policies>
 MultivariatePolynomial<Coeff,Ordering,Policies>::MultivariatePolynomial():
 	mTerms(), mOrdered(true)
@@ -44,7 +42,7 @@ MultivariatePolynomial<Coeff,Ordering,Policies>::MultivariatePolynomial(const Mu
 template<typename Coeff, typename Ordering, typename Policies>
 MultivariatePolynomial<Coeff,Ordering,Policies>::MultivariatePolynomial(MultivariatePolynomial<Coeff, Ordering, Policies>&& p):
 	Policies(p),
-	mTerms(std::move(p.mTerms)),
+	mTerms(moveTermStorage(std::move(p.mTerms))),
 	mOrdered(p.isOrdered())
 {
 	assert(this->isConsistent());
@@ -129,19 +127,20 @@ MultivariatePolynomial<Coeff,Ordering,Policies>::MultivariatePolynomial(const Un
 	mTerms(),
 	mOrdered(false)
 {
-	auto id = mTermAdditionManager.getId();
+	auto& tam = termAdditionManager();
+	auto id = tam.getId();
 	exponent exp = 0;
 	for (const auto& c: p.coefficients()) {
 		if (exp == 0) {
-			for (const auto& term: c) mTermAdditionManager.template addTerm<true>(id, term);
+			for (const auto& term: c) tam.template addTerm<true>(id, term);
 		} else {
 			for (const auto& term: c * Term<Coeff>(constant_one<Coeff>::get(), p.mainVar(), exp)) {
-				mTermAdditionManager.template addTerm<true>(id, term);
+				tam.template addTerm<true>(id, term);
 			}
 		}
 		exp++;
 	}
-	mTermAdditionManager.readTerms(id, mTerms);
+	tam.readTerms(id, mTerms);
 	makeMinimallyOrdered<false, true>();
 	assert(this->isConsistent());
 }
@@ -184,9 +183,10 @@ MultivariatePolynomial<Coeff, Ordering, Policies>::MultivariatePolynomial(Multiv
 	mOrdered(ordered)
 {
 	if( duplicates ) {
-		auto id = mTermAdditionManager.getId(mTerms.size());
-		for (const auto& t: mTerms) mTermAdditionManager.template addTerm<false>(id, t);
-		mTermAdditionManager.readTerms(id, mTerms);
+		auto& tam = termAdditionManager();
+		auto id = tam.getId(mTerms.size());
+		for (const auto& t: mTerms) tam.template addTerm<false>(id, t);
+		tam.readTerms(id, mTerms);
 		mOrdered = false;
 	}
 
@@ -207,11 +207,12 @@ MultivariatePolynomial<Coeff, Ordering, Policies>::MultivariatePolynomial(const
 	mOrdered(ordered)
 {
 	if( duplicates ) {
-		auto id = mTermAdditionManager.getId(mTerms.size());
+		auto& tam = termAdditionManager();
+		auto id = tam.getId(mTerms.size());
 		for (const auto& t: mTerms) {
-			mTermAdditionManager.template addTerm<false>(id, t);
+			tam.template addTerm<false>(id, t);
 		}
-		mTermAdditionManager.readTerms(id, mTerms);
+		tam.readTerms(id, mTerms);
 	}
 	if (!ordered) {
 		makeMinimallyOrdered();
@@ -393,16 +394,17 @@ void MultivariatePolynomial<Coeff,Ordering,Policies>::subtractProduct(const Term
 		return;
 	}
 
-	auto id = mTermAdditionManager.getId(mTerms.size() + p.mTerms.size());
+	auto& tam = termAdditionManager();
+	auto id = tam.getId(mTerms.size() + p.mTerms.size());
 	for (const auto& term: mTerms) {
-		mTermAdditionManager.template addTerm<false>(id, term);
+		tam.template addTerm<false>(id, term);
 	}
 	for (const auto& term: p.mTerms) {
 		Coeff c = - factor.coeff() * term.coeff();
 		auto m = factor.monomial() * term.monomial();
-		mTermAdditionManager.template addTerm<false>(id, TermType(c, m));
+		tam.template addTerm<false>(id, TermType(c, m));
 	}
-	mTermAdditionManager.readTerms(id, mTerms);
+	tam.readTerms(id, mTerms);
 	mOrdered = false;
 	makeMinimallyOrdered<false, true>();
 	assert(this->isConsistent());
@@ -703,14 +705,15 @@ MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff,
         mTerms.pop_back();
 		--rhsEnd;
 	}
-	auto id = mTermAdditionManager.getId(mTerms.size() + rhs.mTerms.size());
+	auto& tam = termAdditionManager();
+	auto id = tam.getId(mTerms.size() + rhs.mTerms.size());
 	for (auto termIter = mTerms.begin(); termIter != mTerms.end(); ++termIter) {
-		mTermAdditionManager.template addTerm<false,false>(id, *termIter);
+		tam.template addTerm<false,false>(id, *termIter);
 	}
 	for (auto termIter = rhs.mTerms.begin(); termIter != rhsEnd; ++termIter) {
-		mTermAdditionManager.template addTerm<false,false>(id, *termIter);
+		tam.template addTerm<false,false>(id, *termIter);
 	}
-	mTermAdditionManager.readTerms(id, mTerms);
+	tam.readTerms(id, mTerms);
 	if (carl::isZero(newlterm)) {
 		makeMinimallyOrdered<false,true>();
 	} else {
@@ -767,12 +770,13 @@ MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff,
 		mTerms.push_back(rhs);
 	} else {
 		// Full-blown addition.
-		auto id = mTermAdditionManager.getId(mTerms.size()+1);
+		auto& tam = termAdditionManager();
+		auto id = tam.getId(mTerms.size()+1);
 		for (const auto& term: mTerms) {
-			mTermAdditionManager.template addTerm<false>(id, term);
+			tam.template addTerm<false>(id, term);
 		}
-		mTermAdditionManager.template addTerm<false>(id, rhs);
-		mTermAdditionManager.readTerms(id, mTerms);
+		tam.template addTerm<false>(id, rhs);
+		tam.readTerms(id, mTerms);
 		makeMinimallyOrdered<false, true>();
 		mOrdered = false;
 	}
@@ -902,14 +906,15 @@ MultivariatePolynomial<Coeff, Ordering, Policies>& MultivariatePolynomial<Coeff,
 		return *this += c;
 	}
 
-	auto id = mTermAdditionManager.getId(mTerms.size() + rhs.mTerms.size());
+	auto& tam = termAdditionManager();
+	auto id = tam.getId(mTerms.size() + rhs.mTerms.size());
 	for (const auto& term: mTerms) {
-		mTermAdditionManager.template addTerm<false>(id, term);
+		tam.template addTerm<false>(id, term);
 	}
 	for (const auto& term: rhs.mTerms) {
-		mTermAdditionManager.template addTerm<false>(id, -term);
+		tam.template addTerm<false>(id, -term);
 	}
-	mTermAdditionManager.readTerms(id, mTerms);
+	tam.readTerms(id, mTerms);
 	mOrdered = false;
 	makeMinimallyOrdered<false, true>();
 	assert(this->isConsistent());
@@ -1053,7 +1058,107 @@ MultivariatePolynomial<Coeff,Ordering,Policies>& MultivariatePolynomial<Coeff,Or
 		*this = rhs;
 		return *this *= c;
 	}
-	auto id = mTermAdditionManager.getId(mTerms.size() * rhs.mTerms.size());
+	if (preferHeapMultiplication(rhs)) {
+		return multiplyHeap(rhs);
+	}
+	return multiplyTermAddition(rhs);
+}
+template<typename Coeff, typename Ordering, typename Policies>
+bool MultivariatePolynomial<Coeff,Ordering,Policies>::preferHeapMultiplication(const MultivariatePolynomial<Coeff,Ordering,Policies>& rhs) const
+{
+	std::size_t products = mTerms.size() * rhs.mTerms.size();
+	if (products < Policies::heapMultiplicationMinProducts) return false;
+	// Sum of the maximal exponents of every variable in both factors.
+	std::map<Variable, std::size_t> degrees;
+	std::map<Variable, std::size_t> rhsDegrees;
+	auto collect = [](const TermsType& terms, std::map<Variable, std::size_t>& deg) {
+		for (const auto& t: terms) {
+			if (!t.monomial()) continue;
+			for (const auto& ve: *t.monomial()) {
+				auto& d = deg[ve.first];
+				d = std::max(d, std::size_t(ve.second));
+			}
+		}
+	};
+	collect(mTerms, degrees);
+	collect(rhs.mTerms, rhsDegrees);
+	for (const auto& vd: rhsDegrees) degrees[vd.first] += vd.second;
+	// Number of monomials within these degree bounds, saturated once it exceeds the limit.
+	std::size_t limit = products / Policies::heapMultiplicationDensity;
+	std::size_t monomials = 1;
+	for (const auto& vd: degrees) {
+		monomials *= vd.second + 1;
+		if (monomials > limit) return false;
+	}
+	return true;
+}
+template<typename Coeff, typename Ordering, typename Policies>
+MultivariatePolynomial<Coeff,Ordering,Policies>& MultivariatePolynomial<Coeff,Ordering,Policies>::multiplyHeap(const MultivariatePolynomial<Coeff,Ordering,Policies>& rhs)
+{
+	assert(this->isConsistent());
+	assert(rhs.isConsistent());
+	if (mTerms.empty() || rhs.mTerms.empty()) {
+		mTerms.clear();
+		return *this;
+	}
+	makeOrdered();
+	rhs.makeOrdered();
+	// The heap holds at most one entry per term of the outer polynomial.
+	const TermsType& outer = (mTerms.size() <= rhs.mTerms.size()) ? mTerms : rhs.mTerms;
+	const TermsType& inner = (&outer == &mTerms) ? rhs.mTerms : mTerms;
+	// Terms are ordered ascendingly, hence we index them from the back.
+	auto outerTerm = [&outer](std::size_t i) -> const TermType& { return outer[outer.size() - 1 - i]; };
+	auto innerTerm = [&inner](std::size_t j) -> const TermType& { return inner[inner.size() - 1 - j]; };
+
+	struct Entry {
+		Monomial::Arg monomial;
+		std::size_t outer;
+		std::size_t inner;
+	};
+	auto entryLess = [](const Entry& lhs, const Entry& rhs){ return Ordering::less(lhs.monomial, rhs.monomial); };
+	std::vector<Entry> heap;
+	heap.reserve(outer.size());
+	auto push = [&](std::size_t i, std::size_t j) {
+		heap.push_back(Entry{ outerTerm(i).monomial() * innerTerm(j).monomial(), i, j });
+		std::push_heap(heap.begin(), heap.end(), entryLess);
+	};
+
+	TermsType newTerms;
+	push(0, 0);
+	while (!heap.empty()) {
+		Monomial::Arg monomial = heap.front().monomial;
+		Coeff coeff = constant_zero<Coeff>::get();
+		// Every product that is not in the heap has a predecessor in the heap with a strictly larger monomial.
+		// Hence all products with this monomial are in the heap right now.
+		while (!heap.empty() && heap.front().monomial == monomial) {
+			std::pop_heap(heap.begin(), heap.end(), entryLess);
+			Entry e = std::move(heap.back());
+			heap.pop_back();
+			coeff += outerTerm(e.outer).coeff() * innerTerm(e.inner).coeff();
+			if (e.inner + 1 < inner.size()) push(e.outer, e.inner + 1);
+			if (e.inner == 0 && e.outer + 1 < outer.size()) push(e.outer + 1, 0);
+		}
+		if (!carl::isZero(coeff)) {
+			newTerms.emplace_back(std::move(coeff), std::move(monomial));
+		}
+	}
+	std::reverse(newTerms.begin(), newTerms.end());
+	mTerms = std::move(newTerms);
+	mOrdered = true;
+	assert(this->isConsistent());
+	return *this;
+}
+template<typename Coeff, typename Ordering, typename Policies>
+MultivariatePolynomial<Coeff,Ordering,Policies>& MultivariatePolynomial<Coeff,Ordering,Policies>::multiplyTermAddition(const MultivariatePolynomial<Coeff,Ordering,Policies>& rhs)
+{
+	assert(this->isConsistent());
+	assert(rhs.isConsistent());
+	if (mTerms.empty() || rhs.mTerms.empty()) {
+		mTerms.clear();
+		return *this;
+	}
+	auto& tam = termAdditionManager();
+	auto id = tam.getId(mTerms.size() * rhs.mTerms.size());
 	TermType newlterm;
 	bool first = true;
 	for (auto t1 = mTerms.rbegin(); t1 != mTerms.rend(); t1++) {
@@ -1061,10 +1166,10 @@ MultivariatePolynomial<Coeff,Ordering,Policies>& MultivariatePolynomial<Coeff,Or
 			if (first) {
 				newlterm = *t1 * *t2;
 				first = false;
-			} else mTermAdditionManager.template addTerm<false>(id, std::move((*t1)*(*t2)));
+			} else tam.template addTerm<false>(id, std::move((*t1)*(*t2)));
 		}
 	}
-	mTermAdditionManager.readTerms(id, mTerms);
+	tam.readTerms(id, mTerms);
 	if (carl::isZero(newlterm)) makeMinimallyOrdered<false, true>();
 	else mTerms.push_back(newlterm);
 	//makeMinimallyOrdered<false, true>();
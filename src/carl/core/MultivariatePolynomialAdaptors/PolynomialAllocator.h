@@ -1,4 +1,4 @@
-/** 
+/**
  * @file:   PolynomialAllocator.h
  * @author: Sebastian Junges
  *
@@ -7,10 +7,227 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <vector>
+
 namespace carl
 {
+/**
+ * Allocator policy that stores the terms of a polynomial on the heap using std::allocator.
+ */
 struct NoAllocator
 {
-	
+	template<typename T>
+	using allocator = std::allocator<T>;
+};
+
+/**
+ * A simple bump allocator that hands out memory from a list of chunks.
+ * Memory is not returned individually, but all at once by release().
+ * Deallocating the most recent allocation rolls back the bump pointer, which makes the repeated reallocation of a growing vector cheap.
+ *
+ * An arena is not thread-safe and is only meant to be used from the thread that installed it via PolynomialArenaScope.
+ */
+class PolynomialArena {
+	struct Chunk {
+		std::unique_ptr<char[]> data;
+		std::size_t size;
+	};
+	/// Size of newly allocated chunks.
+	std::size_t mChunkSize;
+	/// Chunks that are in use, the last one is the current chunk.
+	std::vector<Chunk> mChunks;
+	/// Offset of the next free byte in the current chunk.
+	std::size_t mOffset = 0;
+	/// Start of the most recent allocation, used to roll back deallocations.
+	void* mLast = nullptr;
+	/// Number of bytes handed out since the last release().
+	std::size_t mAllocated = 0;
+
+	void newChunk(std::size_t bytes) {
+		std::size_t size = std::max(mChunkSize, bytes);
+		mChunks.push_back(Chunk{ std::unique_ptr<char[]>(new char[size]), size });
+		mOffset = 0;
+	}
+
+	static PolynomialArena*& currentRef() {
+		static thread_local PolynomialArena* arena = nullptr;
+		return arena;
+	}
+public:
+	explicit PolynomialArena(std::size_t chunkSize = 64 * 1024): mChunkSize(chunkSize) {}
+	PolynomialArena(const PolynomialArena&) = delete;
+	PolynomialArena& operator=(const PolynomialArena&) = delete;
+
+	/**
+	 * Returns memory for bytes many bytes with the given alignment.
+	 */
+	void* allocate(std::size_t bytes, std::size_t alignment) {
+		if (!mChunks.empty()) {
+			auto base = reinterpret_cast<std::uintptr_t>(mChunks.back().data.get());
+			std::size_t start = ((base + mOffset + alignment - 1) & ~(alignment - 1)) - base;
+			if (start + bytes <= mChunks.back().size) {
+				mOffset = start + bytes;
+				mAllocated += bytes;
+				mLast = mChunks.back().data.get() + start;
+				return mLast;
+			}
+		}
+		newChunk(bytes + alignment);
+		return allocate(bytes, alignment);
+	}
+	/**
+	 * Returns memory to the arena.
+	 * Only the most recent allocation is actually reused, everything else is freed by release().
+	 */
+	void deallocate(void* p, std::size_t bytes) {
+		if (p != nullptr && p == mLast) {
+			mOffset = static_cast<std::size_t>(static_cast<char*>(p) - mChunks.back().data.get());
+			mAllocated -= bytes;
+			mLast = nullptr;
+		}
+	}
+	/**
+	 * Frees all memory handed out by this arena.
+	 * The largest chunk is kept such that the arena can be reused without allocating again.
+	 * All objects still using memory from this arena become invalid.
+	 */
+	void release() {
+		if (mChunks.size() > 1) {
+			auto largest = std::max_element(mChunks.begin(), mChunks.end(), [](const Chunk& a, const Chunk& b){ return a.size < b.size; });
+			Chunk keep = std::move(*largest);
+			mChunks.clear();
+			mChunks.push_back(std::move(keep));
+		}
+		mOffset = 0;
+		mLast = nullptr;
+		mAllocated = 0;
+	}
+	/// Number of bytes handed out since the last release().
+	std::size_t allocated() const {
+		return mAllocated;
+	}
+	/// Number of chunks currently held.
+	std::size_t chunks() const {
+		return mChunks.size();
+	}
+
+	/**
+	 * Returns the arena installed for the current thread or nullptr if allocations go to the heap.
+	 */
+	static PolynomialArena* current() {
+		return currentRef();
+	}
+
+	friend class PolynomialArenaScope;
+};
+
+/**
+ * Installs an arena for the current thread for the lifetime of this object and restores the previous one afterwards.
+ * Polynomials using the ArenaAllocator policy that are created or copied while the scope is active take their term storage from the arena.
+ * Passing nullptr makes them use the heap again, for example to copy results out of the arena before it is released.
+ */
+class PolynomialArenaScope {
+	PolynomialArena* mPrevious;
+public:
+	explicit PolynomialArenaScope(PolynomialArena* arena): mPrevious(PolynomialArena::currentRef()) {
+		PolynomialArena::currentRef() = arena;
+	}
+	explicit PolynomialArenaScope(PolynomialArena& arena): PolynomialArenaScope(&arena) {}
+	PolynomialArenaScope(const PolynomialArenaScope&) = delete;
+	PolynomialArenaScope& operator=(const PolynomialArenaScope&) = delete;
+	~PolynomialArenaScope() {
+		PolynomialArena::currentRef() = mPrevious;
+	}
+};
+
+/**
+ * Allocator policy that stores the terms of a polynomial in the PolynomialArena of the current thread, if there is one.
+ * The arena is fixed when the term storage is created, later changes to the current arena do not affect existing polynomials.
+ * The arena is never transferred to another polynomial:
+ * - move construction copies terms from an arena to the heap (see moveTermStorage()),
+ * - move assignment keeps the storage of the target, if both sides use different arenas the terms are moved element-wise,
+ * - swapping polynomials is done by moves and hence keeps the storage of both sides.
+ * Term vectors with different arenas must not be swapped directly, as the allocators are not swapped.
+ * Hence a polynomial only depends on an arena if it was created or copied while the arena was current.
+ * Such polynomials must not be used after the arena has been released.
+ */
+struct ArenaAllocator
+{
+	template<typename T>
+	class allocator {
+		template<typename U> friend class allocator;
+		PolynomialArena* mArena;
+	public:
+		using value_type = T;
+		using propagate_on_container_copy_assignment = std::false_type;
+		using propagate_on_container_move_assignment = std::false_type;
+		using propagate_on_container_swap = std::false_type;
+
+		allocator() noexcept: mArena(PolynomialArena::current()) {}
+		/// Uses the given arena, or the heap if arena is nullptr.
+		explicit allocator(PolynomialArena* arena) noexcept: mArena(arena) {}
+		template<typename U>
+		allocator(const allocator<U>& a) noexcept: mArena(a.mArena) {}
+
+		T* allocate(std::size_t n) {
+			if (mArena == nullptr) {
+				return static_cast<T*>(::operator new(n * sizeof(T)));
+			}
+			return static_cast<T*>(mArena->allocate(n * sizeof(T), alignof(T)));
+		}
+		void deallocate(T* p, std::size_t n) noexcept {
+			if (mArena == nullptr) {
+				::operator delete(p);
+			} else {
+				mArena->deallocate(p, n * sizeof(T));
+			}
+		}
+		/// Copies of a polynomial use the arena that is current at the time of copying.
+		allocator select_on_container_copy_construction() const {
+			return allocator();
+		}
+		PolynomialArena* arena() const {
+			return mArena;
+		}
+
+		template<typename U>
+		bool operator==(const allocator<U>& rhs) const {
+			return mArena == rhs.mArena;
+		}
+		template<typename U>
+		bool operator!=(const allocator<U>& rhs) const {
+			return mArena != rhs.mArena;
+		}
+	};
 };
-}
\ No newline at end of file
+
+/**
+ * Returns the term storage for a polynomial that is move constructed from the given storage.
+ * A vector always takes over the allocator of the vector it is constructed from, hence this is done explicitly for allocators that may refer to an arena.
+ */
+template<typename T, typename A>
+std::vector<T,A> moveTermStorage(std::vector<T,A>&& terms) {
+	return std::move(terms);
+}
+/**
+ * Terms that are stored in an arena are moved into new storage on the heap.
+ */
+template<typename T>
+std::vector<T,ArenaAllocator::allocator<T>> moveTermStorage(std::vector<T,ArenaAllocator::allocator<T>>&& terms) {
+	if (terms.get_allocator().arena() == nullptr) {
+		return std::move(terms);
+	}
+	std::vector<T,ArenaAllocator::allocator<T>> res(ArenaAllocator::allocator<T>(nullptr));
+	res.reserve(terms.size());
+	std::move(terms.begin(), terms.end(), std::back_inserter(res));
+	terms.clear();
+	return res;
+}
+}
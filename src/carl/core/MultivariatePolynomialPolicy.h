@@ -26,9 +26,25 @@ namespace carl
          * Although the worst-case complexity is worse, for polynomials with a small nr of terms, this should be better.
          */
         static const bool searchLinear = true;
+
+        /**
+         * Multiplication of two polynomials uses heap-based merging of the term products only if there are at least this many term products.
+         * For fewer products, collecting them in the TermAdditionManager is faster.
+         */
+        static const std::size_t heapMultiplicationMinProducts = 16384;
+        /**
+         * Multiplication of two polynomials uses heap-based merging of the term products only if the result is dense,
+         * that is if the number of monomials the result can have is at most |p|*|q| / heapMultiplicationDensity.
+         * Then many products collide and the heap merges them early, otherwise the TermAdditionManager is faster.
+         */
+        static const std::size_t heapMultiplicationDensity = 2;
 		
 		// Easy access.
 		static const bool has_reasons = ReasonsAdaptor::has_reasons;
+
+		/// The allocator used for the terms of a polynomial.
+		template<typename T>
+		using allocator = typename Allocator::template allocator<T>;
     };
 	
 }
@@ -19,8 +19,8 @@ MultivariatePolynomial<C,O,P> coprimePart(const MultivariatePolynomial<C,O,P>& p
 
 	auto s = overloaded {
 	#if defined USE_COCOA
-		[](const MultivariatePolynomial<mpq_class,O,P>& p, const MultivariatePolynomial<mpq_class,O,P>& q){ CoCoAAdaptor<MultivariatePolynomial<mpq_class,O,P>> c({p, q}); return c.makeCoprimeWith(p, q); },
-		[](const MultivariatePolynomial<mpz_class,O,P>& p, const MultivariatePolynomial<mpz_class,O,P>& q){ CoCoAAdaptor<MultivariatePolynomial<mpz_class,O,P>> c({p, q}); return c.makeCoprimeWith(p, q); }
+		[](const MultivariatePolynomial<mpq_class,O,P>& p, const MultivariatePolynomial<mpq_class,O,P>& q){ const auto& c = CoCoAAdaptorCache<MultivariatePolynomial<mpq_class,O,P>>::getInstance().get({p, q}); return c.makeCoprimeWith(p, q); },
+		[](const MultivariatePolynomial<mpz_class,O,P>& p, const MultivariatePolynomial<mpz_class,O,P>& q){ const auto& c = CoCoAAdaptorCache<MultivariatePolynomial<mpz_class,O,P>>::getInstance().get({p, q}); return c.makeCoprimeWith(p, q); }
 	#else
 		[](const MultivariatePolynomial<mpq_class,O,P>& p, const MultivariatePolynomial<mpq_class,O,P>&){ return p; },
 		[](const MultivariatePolynomial<mpz_class,O,P>& p, const MultivariatePolynomial<mpz_class,O,P>&){ return p; }
@@ -51,7 +51,7 @@ bool try_divide(const Term<Coeff>& t, Variable v, Term<Coeff>& res) {
 template<typename Coeff, typename Ordering, typename Policies>
 MultivariatePolynomial<Coeff,Ordering,Policies> divide(const MultivariatePolynomial<Coeff,Ordering,Policies>& p, const Coeff& divisor) {
 	static_assert(is_field<Coeff>::value);
-	std::vector<Term<Coeff>> new_coeffs;
+	typename MultivariatePolynomial<Coeff,Ordering,Policies>::TermsType new_coeffs;
 	for (const auto& t: p) {
 		new_coeffs.emplace_back(divide(t, divisor));
 	}
@@ -81,7 +81,7 @@ bool try_divide(const MultivariatePolynomial<Coeff,Ordering,Policies>& dividend,
 		quotient = MultivariatePolynomial<Coeff,Ordering,Policies>();
 		return true;
 	}
-	auto& tam = MultivariatePolynomial<Coeff,Ordering,Policies>::mTermAdditionManager;
+	auto& tam = MultivariatePolynomial<Coeff,Ordering,Policies>::termAdditionManager();
 	auto id = tam.getId(0);
 	auto thisid = tam.getId(dividend.nrTerms());
 	for (const auto& t: dividend) {
@@ -220,16 +220,22 @@ DivisionResult<UnivariatePolynomial<Coeff>> divide(const UnivariatePolynomial<Co
 			return result;
 		}
 		std::vector<Coeff> coeffs(1+dividend.coefficients().size()-divisor.coefficients().size(), Coeff(0));
-		
-		do
-		{
-			Coeff factor = result.remainder.lcoeff()/divisor.lcoeff();
-			uint degdiff = result.remainder.degree() - divisor.degree();
-			result.remainder -= UnivariatePolynomial<Coeff>(dividend.mainVar(), factor, degdiff) * divisor;
-			coeffs[degdiff] += factor;
+		// Eliminate the leading coefficients of the remainder in place, avoiding a temporary polynomial for every step.
+		std::vector<Coeff> remainder(dividend.coefficients());
+		const auto& d = divisor.coefficients();
+		std::size_t degree = divisor.degree();
+		for (std::size_t k = coeffs.size(); k-- > 0;) {
+			if (carl::isZero(remainder[k + degree])) continue;
+			Coeff factor = remainder[k + degree] / divisor.lcoeff();
+			for (std::size_t i = 0; i < degree; ++i) {
+				remainder[k + i] -= factor * d[i];
+			}
+			remainder[k + degree] = Coeff(0);
+			coeffs[k] = std::move(factor);
 		}
-		while(!carl::isZero(result.remainder) && divisor.degree() <= result.remainder.degree());
+		remainder.resize(degree);
 		result.quotient = UnivariatePolynomial<Coeff>(dividend.mainVar(), std::move(coeffs));
+		result.remainder = UnivariatePolynomial<Coeff>(dividend.mainVar(), std::move(remainder));
 		assert(dividend == divisor * result.quotient + result.remainder);
 		return result;
 	} else {
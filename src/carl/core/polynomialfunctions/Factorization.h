@@ -59,8 +59,8 @@ Factors<MultivariatePolynomial<C,O,P>> factorization(const MultivariatePolynomia
 
 	auto s = overloaded {
 	#if defined USE_COCOA
-		[includeConstants](const MultivariatePolynomial<mpq_class,O,P>& p){ CoCoAAdaptor<MultivariatePolynomial<mpq_class,O,P>> c({p}); return c.factorize(p, includeConstants); },
-		[includeConstants](const MultivariatePolynomial<mpz_class,O,P>& p){ CoCoAAdaptor<MultivariatePolynomial<mpz_class,O,P>> c({p}); return c.factorize(p, includeConstants); }
+		[includeConstants](const MultivariatePolynomial<mpq_class,O,P>& p){ const auto& c = CoCoAAdaptorCache<MultivariatePolynomial<mpq_class,O,P>>::getInstance().get({p}); return c.factorize(p, includeConstants); },
+		[includeConstants](const MultivariatePolynomial<mpz_class,O,P>& p){ const auto& c = CoCoAAdaptorCache<MultivariatePolynomial<mpz_class,O,P>>::getInstance().get({p}); return c.factorize(p, includeConstants); }
 	#else
 		[](const MultivariatePolynomial<mpq_class,O,P>& p){ return helper::trivialFactorization(p); },
 		[](const MultivariatePolynomial<mpz_class,O,P>& p){ return helper::trivialFactorization(p); }
@@ -89,8 +89,8 @@ std::vector<MultivariatePolynomial<C,O,P>> irreducibleFactors(const Multivariate
 
 	auto s = overloaded {
 	#if defined USE_COCOA
-		[includeConstants](const MultivariatePolynomial<mpq_class,O,P>& p){ CoCoAAdaptor<MultivariatePolynomial<mpq_class,O,P>> c({p}); return c.irreducibleFactors(p, includeConstants); },
-		[includeConstants](const MultivariatePolynomial<mpz_class,O,P>& p){ CoCoAAdaptor<MultivariatePolynomial<mpz_class,O,P>> c({p}); return c.irreducibleFactors(p, includeConstants); }
+		[includeConstants](const MultivariatePolynomial<mpq_class,O,P>& p){ const auto& c = CoCoAAdaptorCache<MultivariatePolynomial<mpq_class,O,P>>::getInstance().get({p}); return c.irreducibleFactors(p, includeConstants); },
+		[includeConstants](const MultivariatePolynomial<mpz_class,O,P>& p){ const auto& c = CoCoAAdaptorCache<MultivariatePolynomial<mpz_class,O,P>>::getInstance().get({p}); return c.irreducibleFactors(p, includeConstants); }
 	#else
 		[includeConstants](const MultivariatePolynomial<mpq_class,O,P>& p){ return std::vector<MultivariatePolynomial<mpq_class,O,P>>({p}); },
 		[includeConstants](const MultivariatePolynomial<mpz_class,O,P>& p){ return std::vector<MultivariatePolynomial<mpz_class,O,P>>({p}); }
@@ -21,7 +21,7 @@ MultivariatePolynomial<C,O,P> quotient(const MultivariatePolynomial<C,O,P>& divi
 	}
 	//static_assert(is_field<C>::value, "Division only defined for field coefficients");
 	MultivariatePolynomial<C,O,P> p(dividend);
-	auto& tam = MultivariatePolynomial<C,O,P>::mTermAdditionManager;
+	auto& tam = MultivariatePolynomial<C,O,P>::termAdditionManager();
 	auto id = tam.getId(p.nrTerms());
 	while(!carl::isZero(p))
 	{
@@ -0,0 +1,181 @@
+#pragma once
+
+#include "Division.h"
+#include "GCD.h"
+#include "SquareFreePart.h"
+
+#include "../logging.h"
+#include "../UnivariatePolynomial.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace carl {
+
+namespace detail_squarefree_basis {
+	/// The prime 2^31-1, such that products of residues fit into 64 bits.
+	constexpr std::uint64_t prime = 2147483647;
+
+	/// Computes the inverse of a nonzero residue by the extended euclidean algorithm.
+	inline std::uint64_t inverse(std::uint64_t a) {
+		std::int64_t t = 0;
+		std::int64_t newt = 1;
+		std::int64_t r = prime;
+		std::int64_t newr = static_cast<std::int64_t>(a);
+		while (newr != 0) {
+			std::int64_t q = r / newr;
+			t = std::exchange(newt, t - q * newt);
+			r = std::exchange(newr, r - q * newr);
+		}
+		return static_cast<std::uint64_t>(t < 0 ? t + static_cast<std::int64_t>(prime) : t);
+	}
+
+	/// The coefficients of a polynomial modulo the prime, if they can be reduced.
+	using Residues = std::optional<std::vector<std::uint64_t>>;
+
+	/// Reduces the coefficients of p modulo the prime, fails if a denominator or the leading coefficient vanishes.
+	template<typename Coeff>
+	Residues reduce(const UnivariatePolynomial<Coeff>& p) {
+		using Integer = typename IntegralType<Coeff>::type;
+		std::vector<std::uint64_t> res;
+		for (const auto& c: p.coefficients()) {
+			Integer num = carl::getNum(c);
+			std::uint64_t n = carl::toInt<uint>(carl::mod(carl::abs(num), Integer(prime)));
+			std::uint64_t d = carl::toInt<uint>(carl::mod(Integer(carl::getDenom(c)), Integer(prime)));
+			if (d == 0) return std::nullopt;
+			if (carl::isNegative(num) && n != 0) n = prime - n;
+			res.emplace_back(n * inverse(d) % prime);
+		}
+		if (res.empty() || res.back() == 0) return std::nullopt;
+		return res;
+	}
+
+	/**
+	 * Computes the degree of the gcd of two polynomials modulo the prime.
+	 * The reduction of the rational gcd divides the modular gcd, hence this is an upper bound for the degree of the rational gcd.
+	 * Returns std::nullopt if one of the polynomials could not be reduced.
+	 */
+	inline std::optional<std::size_t> modular_gcd_degree(const Residues& a, const Residues& b) {
+		if (!a || !b) return std::nullopt;
+		std::vector<std::uint64_t> x = *a;
+		std::vector<std::uint64_t> y = *b;
+		if (x.size() < y.size()) std::swap(x, y);
+		while (!y.empty()) {
+			std::uint64_t lead = inverse(y.back());
+			while (x.size() >= y.size()) {
+				std::uint64_t factor = x.back() * lead % prime;
+				std::size_t offset = x.size() - y.size();
+				for (std::size_t i = 0; i < y.size(); ++i) {
+					x[offset + i] = (x[offset + i] + (prime - factor) * y[i]) % prime;
+				}
+				while (!x.empty() && x.back() == 0) x.pop_back();
+			}
+			std::swap(x, y);
+		}
+		return x.size() - 1;
+	}
+}
+
+/**
+ * A squarefree basis of a family of univariate polynomials, as computed by squareFreeBasis().
+ */
+template<typename Coeff>
+struct SquareFreeBasis {
+	/// Normalized (i.e. monic over fields), squarefree and pairwise coprime polynomials of positive degree.
+	std::vector<UnivariatePolynomial<Coeff>> basis;
+	/// For every input polynomial, the indices into basis of its factors together with their multiplicities.
+	std::vector<std::vector<std::pair<std::size_t, std::size_t>>> factors;
+};
+
+/**
+ * Computes a squarefree basis of the given univariate polynomials,
+ * such that every nonzero input is (up to a constant) the product of powers of some basis elements.
+ * Zero and constant polynomials have no factors.
+ *
+ * The basis is refined incrementally: a new polynomial p is split against every basis element b by g = gcd(p,b).
+ * If g is a proper factor of b, b is replaced by g and b/g in the basis and in the factors of all previous polynomials.
+ * Afterwards, p is divided by g and the multiplicity of g is incremented until p and b are coprime.
+ * Only the part of p that is coprime to all basis elements is decomposed into squarefree factors from scratch.
+ * Usually, a cheap gcd computation modulo a prime shows that p and b are coprime or that b divides p, and the rational gcd is avoided.
+ * Hence the costs mostly depend on the number of distinct factors, and polynomials consisting of known factors are cheap.
+ */
+template<typename Coeff>
+SquareFreeBasis<Coeff> squareFreeBasis(const std::vector<UnivariatePolynomial<Coeff>>& polys) {
+	SquareFreeBasis<Coeff> res;
+	res.factors.resize(polys.size());
+	// The residues of the basis elements.
+	std::vector<detail_squarefree_basis::Residues> residues;
+	for (std::size_t pid = 0; pid < polys.size(); ++pid) {
+		if (polys[pid].isConstant()) continue;
+		auto& factors = res.factors[pid];
+		auto add_factor = [&factors](std::size_t i) {
+			auto it = std::find_if(factors.begin(), factors.end(), [i](const auto& f){ return f.first == i; });
+			if (it == factors.end()) {
+				factors.emplace_back(i, 1);
+			} else {
+				++it->second;
+			}
+		};
+		auto cur = polys[pid].normalized();
+		auto cur_residues = detail_squarefree_basis::reduce(cur);
+		std::size_t size = res.basis.size();
+		for (std::size_t i = 0; i < size && !cur.isConstant(); ++i) {
+			while (!cur.isConstant()) {
+				auto degree = detail_squarefree_basis::modular_gcd_degree(cur_residues, residues[i]);
+				if (degree && *degree == 0) break;
+				if (degree && *degree == res.basis[i].degree() && res.basis[i].degree() <= cur.degree()) {
+					// Most likely, the basis element divides the polynomial.
+					auto d = carl::divide(cur, res.basis[i]);
+					if (carl::isZero(d.remainder)) {
+						cur = std::move(d.quotient);
+						cur_residues = detail_squarefree_basis::reduce(cur);
+						add_factor(i);
+						continue;
+					}
+				}
+				auto g = carl::gcd(cur, res.basis[i]);
+				if (g.isConstant()) break;
+				if (g.degree() < res.basis[i].degree()) {
+					std::size_t split = res.basis.size();
+					res.basis.emplace_back(carl::divide(res.basis[i], g).quotient.normalized());
+					residues.emplace_back(detail_squarefree_basis::reduce(res.basis.back()));
+					res.basis[i] = g.normalized();
+					residues[i] = detail_squarefree_basis::reduce(res.basis[i]);
+					for (std::size_t p = 0; p <= pid; ++p) {
+						for (std::size_t f = 0, fs = res.factors[p].size(); f < fs; ++f) {
+							if (res.factors[p][f].first == i) {
+								res.factors[p].emplace_back(split, res.factors[p][f].second);
+							}
+						}
+					}
+				}
+				cur = carl::divide(cur, g).quotient;
+				cur_residues = detail_squarefree_basis::reduce(cur);
+				add_factor(i);
+			}
+		}
+		// The remaining part is coprime to the basis. levels[k] is the product of its factors with multiplicity greater than k.
+		std::vector<UnivariatePolynomial<Coeff>> levels;
+		while (!cur.isConstant()) {
+			levels.emplace_back(carl::squareFreePart(cur).normalized());
+			cur = carl::divide(cur, levels.back()).quotient;
+		}
+		for (std::size_t k = 0; k < levels.size(); ++k) {
+			auto f = ((k + 1 < levels.size()) ? carl::divide(levels[k], levels[k+1]).quotient : levels[k]).normalized();
+			if (f.isConstant()) continue;
+			factors.emplace_back(res.basis.size(), k + 1);
+			residues.emplace_back(detail_squarefree_basis::reduce(f));
+			res.basis.emplace_back(std::move(f));
+		}
+	}
+	for (auto& f: res.factors) {
+		std::sort(f.begin(), f.end());
+	}
+	CARL_LOG_DEBUG("carl.core.sqfree", "Squarefree basis of " << polys << " is " << res.basis << " with factors " << res.factors);
+	return res;
+}
+
+}
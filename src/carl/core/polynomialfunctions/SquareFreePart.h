@@ -19,8 +19,8 @@ MultivariatePolynomial<C,O,P> squareFreePart(const MultivariatePolynomial<C,O,P>
 
 	auto s = overloaded {
 	#if defined USE_COCOA
-		[](const MultivariatePolynomial<mpq_class,O,P>& p){ CoCoAAdaptor<MultivariatePolynomial<mpq_class,O,P>> c({p}); return c.squareFreePart(p); },
-		[](const MultivariatePolynomial<mpz_class,O,P>& p){ CoCoAAdaptor<MultivariatePolynomial<mpz_class,O,P>> c({p}); return c.squareFreePart(p); }
+		[](const MultivariatePolynomial<mpq_class,O,P>& p){ const auto& c = CoCoAAdaptorCache<MultivariatePolynomial<mpq_class,O,P>>::getInstance().get({p}); return c.squareFreePart(p); },
+		[](const MultivariatePolynomial<mpz_class,O,P>& p){ const auto& c = CoCoAAdaptorCache<MultivariatePolynomial<mpz_class,O,P>>::getInstance().get({p}); return c.squareFreePart(p); }
 	#else
 		[](const MultivariatePolynomial<mpq_class,O,P>& p){ return p; },
 		[](const MultivariatePolynomial<mpz_class,O,P>& p){ return p; }
@@ -6,8 +6,56 @@
 
 #include "../Monomial.h"
 
+#include <limits>
+#include <vector>
+
 namespace carl {
 
+namespace detail_substitution {
+	/**
+	 * Caches the powers of the values of variables that are substituted into many terms.
+	 * Variables are looked up by their id and type, hence a lookup is a vector access instead of a map lookup.
+	 */
+	template<typename Coeff>
+	class PowerCache {
+		static constexpr std::size_t none = std::numeric_limits<std::size_t>::max();
+		/// Maps the id and type of a variable to its index in mPowers.
+		std::vector<std::size_t> mSlots;
+		/// mVariables[i] is the variable of the i-th value.
+		std::vector<Variable> mVariables;
+		/// mPowers[i][e-1] is the e-th power of the i-th value.
+		std::vector<std::vector<Coeff>> mPowers;
+
+		/// Ids are only unique per variable type, hence the type is part of the slot.
+		static std::size_t slot(Variable var) {
+			return var.id() * static_cast<std::size_t>(VariableType::TYPE_SIZE) + static_cast<std::size_t>(var.type());
+		}
+	public:
+		explicit PowerCache(const std::map<Variable, Coeff>& values) {
+			for (const auto& [var, value]: values) {
+				if (slot(var) >= mSlots.size()) mSlots.resize(slot(var) + 1, none);
+				mSlots[slot(var)] = mPowers.size();
+				mVariables.push_back(var);
+				mPowers.emplace_back(std::vector<Coeff>({ value }));
+			}
+		}
+		/**
+		 * Returns the given power of the value of var, or nullptr if var has no value.
+		 * The pointer is invalidated by the next call.
+		 */
+		const Coeff* get(Variable var, std::size_t exp) {
+			assert(exp > 0);
+			std::size_t s = slot(var);
+			if (s >= mSlots.size() || mSlots[s] == none || mVariables[mSlots[s]] != var) return nullptr;
+			auto& powers = mPowers[mSlots[s]];
+			while (powers.size() < exp) {
+				powers.emplace_back(powers.back() * powers.front());
+			}
+			return &powers[exp - 1];
+		}
+	};
+}
+
 /**
  * Applies the given substitutions to a monomial.
  * Every variable may be substituted by some value.
@@ -67,7 +115,8 @@ void substitute_inplace(MultivariatePolynomial<C,O,P>& p, Variable var, const Mu
 	if (!p.has(var)) {
 		return;
 	}
-	typename MultivariatePolynomial<C,O,P>::TermsType newTerms;
+	// Use the allocator of p, such that the storage can be swapped.
+	typename MultivariatePolynomial<C,O,P>::TermsType newTerms(p.getTerms().get_allocator());
 	// If we replace a variable by zero, just eliminate all terms containing the variable.
 	if(carl::isZero(value))
 	{
@@ -142,7 +191,7 @@ void substitute_inplace(MultivariatePolynomial<C,O,P>& p, Variable var, const Mu
 		}
 	}
 	// Substitute the variable.
-	auto& tam = MultivariatePolynomial<C,O,P>::mTermAdditionManager;
+	auto& tam = MultivariatePolynomial<C,O,P>::termAdditionManager();
 	auto id = tam.getId(expectedResultSize);
 	for (const auto& term: p)
 	{
@@ -182,6 +231,49 @@ void substitute_inplace(MultivariatePolynomial<C,O,P>& p, Variable var, const Mu
 	assert(p.isConsistent());
 }
 
+/**
+ * Substitutes all variables from the given map by their values in a single pass over the terms.
+ * The powers of the values are cached and the resulting terms are accumulated at once,
+ * instead of rebuilding the polynomial for every variable.
+ */
+template<typename C, typename O, typename P>
+void substitute_inplace(MultivariatePolynomial<C,O,P>& p, const std::map<Variable, C>& substitutions) {
+	assert(p.isConsistent());
+	if (substitutions.empty() || p.isConstant()) return;
+	detail_substitution::PowerCache<C> powers(substitutions);
+	auto& tam = MultivariatePolynomial<C,O,P>::termAdditionManager();
+	auto id = tam.getId(p.nrTerms());
+	Monomial::Content content;
+	for (const auto& term: p) {
+		if (term.monomial() == nullptr) {
+			tam.template addTerm<false>(id, term);
+			continue;
+		}
+		C coeff = term.coeff();
+		content.clear();
+		for (const auto& [var, exp]: *term.monomial()) {
+			const C* value = powers.get(var, exp);
+			if (value == nullptr) {
+				content.emplace_back(var, exp);
+			} else {
+				coeff *= *value;
+			}
+		}
+		if (carl::isZero(coeff)) continue;
+		if (content.size() == term.monomial()->exponents().size()) {
+			tam.template addTerm<false>(id, term);
+		} else if (content.empty()) {
+			tam.template addTerm<false>(id, Term<C>(coeff));
+		} else {
+			tam.template addTerm<false>(id, Term<C>(coeff, createMonomial(Monomial::Content(content))));
+		}
+	}
+	tam.readTerms(id, p.getTerms());
+	p.reset_ordered();
+	p.template makeMinimallyOrdered<false, true>();
+	assert(p.isConsistent());
+}
+
 template<typename C, typename O, typename P>
 MultivariatePolynomial<C,O,P> substitute(const MultivariatePolynomial<C,O,P>& p, Variable var, const MultivariatePolynomial<C,O,P>& value) {
 	MultivariatePolynomial<C,O,P> result(p);
@@ -193,7 +285,7 @@ template<typename C, typename O, typename P, typename S>
 MultivariatePolynomial<C,O,P> substitute(const MultivariatePolynomial<C,O,P>& p, const std::map<Variable,S>& substitutions) {
 	static_assert(!std::is_same<S, Term<C>>::value, "Terms are handled by a separate method.");
 	MultivariatePolynomial<C,O,P> result;
-	auto& tam = MultivariatePolynomial<C,O,P>::mTermAdditionManager;
+	auto& tam = MultivariatePolynomial<C,O,P>::termAdditionManager();
 	auto id = tam.getId(p.nrTerms());
 	for (const auto& term: p) {
 		Term<C> resultTerm = substitute(term, substitutions);
@@ -212,7 +304,7 @@ MultivariatePolynomial<C,O,P> substitute(const MultivariatePolynomial<C,O,P>& p,
 template<typename C, typename O, typename P>
 MultivariatePolynomial<C,O,P> substitute(const MultivariatePolynomial<C,O,P>& p, const std::map<Variable, Term<C>>& substitutions) {
 	MultivariatePolynomial<C,O,P> result;
-	auto& tam = MultivariatePolynomial<C,O,P>::mTermAdditionManager;
+	auto& tam = MultivariatePolynomial<C,O,P>::termAdditionManager();
 	auto id = tam.getId(p.nrTerms());
 	for (const auto& term: p) {
 		tam.template addTerm<false>(id, substitute(term, substitutions));
@@ -76,15 +76,12 @@ namespace carl
                     FormulaPool<Pol>::getInstance().reg( _content );
             }
 
-            #ifdef THREAD_SAFE
-            #define ACTIVITY_LOCK_GUARD std::lock_guard<std::mutex> lock1( mpContent->mActivityMutex );
-            #define DIFFICULTY_LOCK_GUARD std::lock_guard<std::mutex> lock2( mpContent->mDifficultyMutex );
-            #define COLLECT_VARIABLES_LOCK_GUARD std::lock_guard<std::mutex> lock3( mpContent->mCollectVariablesMutex );
-            #else
-            #define ACTIVITY_LOCK_GUARD
-            #define DIFFICULTY_LOCK_GUARD
-            #define COLLECT_VARIABLES_LOCK_GUARD
-            #endif
+            /// Tag for contents whose usage has already been registered by FormulaPool::createRegistered().
+            struct Registered {};
+
+            Formula( const FormulaContent<Pol>* _content, Registered ):
+                mpContent( _content )
+            {}
 
         public:
 
@@ -95,80 +92,80 @@ namespace carl
             static void init( FormulaContent<Pol>& _content );
 
             explicit Formula( FormulaType _type = FALSE ):
-                Formula( FormulaPool<Pol>::getInstance().create( _type ) )
+                Formula( FormulaPool<Pol>::getInstance().createRegistered( _type ), Registered() )
             {}
 
             explicit Formula( Variable::Arg _booleanVar ):
-                Formula( FormulaPool<Pol>::getInstance().create( _booleanVar ) )
+                Formula( FormulaPool<Pol>::getInstance().createRegistered( _booleanVar ), Registered() )
             {}
 
             explicit Formula( const Pol& _pol, Relation _rel ):
-                Formula( FormulaPool<Pol>::getInstance().create( Constraint<Pol>( _pol, _rel ) ) )
+                Formula( FormulaPool<Pol>::getInstance().createRegistered( Constraint<Pol>( _pol, _rel ) ), Registered() )
             {}
 
             explicit Formula( const Constraint<Pol>& _constraint ):
-                Formula( FormulaPool<Pol>::getInstance().create( _constraint ) )
+                Formula( FormulaPool<Pol>::getInstance().createRegistered( _constraint ), Registered() )
             {}
 
 			explicit Formula( const VariableComparison<Pol>& _variableComparison ):
-				Formula( FormulaPool<Pol>::getInstance().create( _variableComparison ) )
+				Formula( FormulaPool<Pol>::getInstance().createRegistered( _variableComparison ), Registered() )
 			{}
 
 			explicit Formula( const VariableAssignment<Pol>& _variableAssignment ):
-				Formula( FormulaPool<Pol>::getInstance().create( _variableAssignment ) )
+				Formula( FormulaPool<Pol>::getInstance().createRegistered( _variableAssignment ), Registered() )
 			{}
 
             explicit Formula( const BVConstraint& _constraint ):
-                Formula( FormulaPool<Pol>::getInstance().create( _constraint ) )
+                Formula( FormulaPool<Pol>::getInstance().createRegistered( _constraint ), Registered() )
             {}
 
             explicit Formula( FormulaType _type, Formula&& _subformula ):
-                Formula(FormulaPool<Pol>::getInstance().create(_type, std::move(_subformula)))
+                Formula(FormulaPool<Pol>::getInstance().createRegistered(_type, std::move(_subformula)), Registered())
             {}
 
             explicit Formula( FormulaType _type, const Formula& _subformula ):
-                Formula(FormulaPool<Pol>::getInstance().create(_type, std::move(Formula(_subformula))))
+                Formula(FormulaPool<Pol>::getInstance().createRegistered(_type, std::move(Formula(_subformula))), Registered())
             {}
 
             explicit Formula( FormulaType _type, const Formula& _subformulaA, const Formula& _subformulaB ):
-                Formula( FormulaPool<Pol>::getInstance().create( _type, {_subformulaA, _subformulaB} ))
+                Formula( FormulaPool<Pol>::getInstance().createRegistered( _type, Formulas<Pol>( {_subformulaA, _subformulaB} ) ), Registered())
             {
                 assert( _type == FormulaType::AND || _type == FormulaType::IFF || _type == FormulaType::IMPLIES || _type == FormulaType::OR || _type == FormulaType::XOR );
             }
 
             explicit Formula( FormulaType _type, const Formula& _subformulaA, const Formula& _subformulaB, const Formula& _subformulaC):
-                Formula( FormulaPool<Pol>::getInstance().create(_type, {_subformulaA, _subformulaB, _subformulaC}))
+                Formula( FormulaPool<Pol>::getInstance().createRegistered(_type, Formulas<Pol>( {_subformulaA, _subformulaB, _subformulaC} )), Registered())
             {}
 
             explicit Formula( FormulaType _type, const FormulasMulti<Pol>& _subformulas ):
-                Formula( FormulaPool<Pol>::getInstance().create( _subformulas ) )
+                Formula( FormulaPool<Pol>::getInstance().createRegistered( _subformulas ), Registered() )
             {
                 assert( _type == FormulaType::XOR );
             }
 
             explicit Formula( FormulaType _type, const Formulas<Pol>& _subasts ):
-                Formula( FormulaPool<Pol>::getInstance().create( _type, _subasts ) )
+                Formula( FormulaPool<Pol>::getInstance().createRegistered( _type, _subasts ), Registered() )
             {}
 
             explicit Formula( FormulaType _type, Formulas<Pol>&& _subasts ):
-                Formula( FormulaPool<Pol>::getInstance().create( _type, std::move(_subasts) ) )
+                Formula( FormulaPool<Pol>::getInstance().createRegistered( _type, std::move(_subasts) ), Registered() )
             {}
 
             explicit Formula( FormulaType _type, const std::initializer_list<Formula<Pol>>& _subasts ):
-                Formula( FormulaPool<Pol>::getInstance().create( _type, std::move(Formulas<Pol>(_subasts.begin(), _subasts.end()) ) ))
+                Formula( FormulaPool<Pol>::getInstance().createRegistered( _type, std::move(Formulas<Pol>(_subasts.begin(), _subasts.end()) ) ), Registered())
             {}
 
             explicit Formula( FormulaType _type, const FormulaSet<Pol>& _subasts ):
-                Formula( FormulaPool<Pol>::getInstance().create( _type, std::move(Formulas<Pol>(_subasts.begin(), _subasts.end()) ) ))
+                Formula( FormulaPool<Pol>::getInstance().createRegistered( _type, std::move(Formulas<Pol>(_subasts.begin(), _subasts.end()) ) ), Registered())
             {}
 
             // TODO: Does the following constructor anything more efficient than the one before?
             explicit Formula( FormulaType _type, FormulaSet<Pol>&& _subasts ):
-                Formula( FormulaPool<Pol>::getInstance().create( _type, std::move(Formulas<Pol>(_subasts.begin(), _subasts.end()) ) ))
+                Formula( FormulaPool<Pol>::getInstance().createRegistered( _type, std::move(Formulas<Pol>(_subasts.begin(), _subasts.end()) ) ), Registered())
             {}
 
             explicit Formula( FormulaType _type, std::vector<Variable>&& _vars, const Formula& _term ):
-                Formula( FormulaPool<Pol>::getInstance().create( _type, std::move( _vars ), _term ) )
+                Formula( FormulaPool<Pol>::getInstance().createRegistered( _type, std::move( _vars ), _term ), Registered() )
             {}
 
             explicit Formula( FormulaType _type, const std::vector<Variable>& _vars, const Formula& _term ):
@@ -176,15 +173,15 @@ namespace carl
             {}
 
             explicit Formula( const UTerm& _lhs, const UTerm& _rhs, bool _negated ):
-                Formula( FormulaPool<Pol>::getInstance().create( _lhs, _rhs, _negated ) )
+                Formula( FormulaPool<Pol>::getInstance().createRegistered( _lhs, _rhs, _negated ), Registered() )
             {}
 
             explicit Formula( UEquality&& _eq ):
-                Formula( FormulaPool<Pol>::getInstance().create( std::move( _eq ) ) )
+                Formula( FormulaPool<Pol>::getInstance().createRegistered( std::move( _eq ) ), Registered() )
             {}
 
             explicit Formula( const UEquality& _eq ):
-                Formula( FormulaPool<Pol>::getInstance().create( std::move( UEquality( _eq ) ) ) )
+                Formula( FormulaPool<Pol>::getInstance().createRegistered( std::move( UEquality( _eq ) ) ), Registered() )
             {}
 
             Formula( const Formula& _formula ):
@@ -234,8 +231,7 @@ namespace carl
              */
             double activity() const
             {
-                ACTIVITY_LOCK_GUARD
-                return mpContent->mActivity;
+                return mpContent->mActivity.load( std::memory_order_relaxed );
             }
 
             /**
@@ -244,8 +240,7 @@ namespace carl
              */
             void setActivity( double _activity ) const
             {
-                ACTIVITY_LOCK_GUARD
-                mpContent->mActivity = _activity;
+                mpContent->mActivity.store( _activity, std::memory_order_relaxed );
             }
 
             /**
@@ -253,8 +248,7 @@ namespace carl
              */
             double difficulty() const
             {
-                DIFFICULTY_LOCK_GUARD
-                return mpContent->mDifficulty;
+                return mpContent->mDifficulty.load( std::memory_order_relaxed );
             }
 
             /**
@@ -263,8 +257,7 @@ namespace carl
              */
             void setDifficulty( double difficulty ) const
             {
-                DIFFICULTY_LOCK_GUARD
-                mpContent->mDifficulty = difficulty;
+                mpContent->mDifficulty.store( difficulty, std::memory_order_relaxed );
             }
 
             /**
@@ -317,16 +310,22 @@ namespace carl
 
             const Variables& variables() const
             {
-                COLLECT_VARIABLES_LOCK_GUARD
-                if( mpContent->mpVariables != nullptr )
+                Variables* cached = mpContent->mpVariables.load( std::memory_order_acquire );
+                if( cached != nullptr )
                 {
-                    return *(mpContent->mpVariables);
+                    return *cached;
                 }
                 carlVariables vars;
                 gatherVariables(vars);
                 auto varvector = vars.underlyingVariables();
-                mpContent->mpVariables = new Variables(varvector.begin(), varvector.end());
-                return *(mpContent->mpVariables);
+                auto result = new Variables(varvector.begin(), varvector.end());
+                // If another thread was faster, its result is used instead.
+                if( !mpContent->mpVariables.compare_exchange_strong( cached, result, std::memory_order_acq_rel ) )
+                {
+                    delete result;
+                    return *cached;
+                }
+                return *result;
             }
 
             /**
@@ -12,6 +12,8 @@
 #include "FormulaPool.h"
 #include "ConstraintPool.h"
 
+#include <unordered_map>
+
 namespace carl
 {
     template<typename Pol>
@@ -164,11 +166,13 @@ namespace carl
     template<typename Pol>
     size_t Formula<Pol>::complexity() const
     {
-        size_t result = 0;
+        // The complexity counts every occurrence of a subformula, hence it is accumulated bottom-up per distinct subformula.
+        std::unordered_map<std::size_t,size_t> complexities;
         carl::FormulaVisitor<Formula<Pol>> visitor;
         visitor.visit(*this,
             [&](const Formula& _f)
             {
+                size_t result = 0;
                 switch( _f.getType() )
                 {
                     case FormulaType::TRUE:
@@ -183,8 +187,10 @@ namespace carl
                     default:
                         ++result;
                 }
+                carl::FormulaVisitor<Formula<Pol>>::forallSubformulas(_f, [&](const Formula& _sub){ result += complexities[_sub.getId()]; });
+                complexities[_f.getId()] = result;
             });
-        return result;
+        return complexities[getId()];
     }
 
     template<typename Pol>
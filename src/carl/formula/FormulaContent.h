@@ -2,6 +2,7 @@
 
 #include "../core/logging.h"
 
+#include <atomic>
 #include <iostream>
 #include <variant>
 
@@ -131,18 +132,21 @@ namespace carl {
         private:
             
             // Member.
+            // The members are ordered such that the node is free of padding, as the pool may hold millions of them.
             /// The hash value.
             size_t mHash = 0;
             /// The unique id.
             size_t mId = 0;
             /// The activity for this formula, which means, how much is this formula involved in the solving procedure.
-            mutable double mActivity = 0.0;
+            mutable std::atomic<double> mActivity = 0.0;
             /// Some value stating an expected difficulty of solving this formula for satisfiability.
-            mutable double mDifficulty = 0.0;
+            mutable std::atomic<double> mDifficulty = 0.0;
             /// The number of formulas existing with this content.
-            mutable size_t mUsages = 0;
+            mutable std::atomic<size_t> mUsages = 0;
             /// The type of this formula.
             FormulaType mType;
+            /// Whether this content is queued for reclamation by the pool, guarded by the dead list lock of the pool.
+            mutable bool mQueued = false;
             /// The content of this formula.
             std::variant<carl::Variable, // The variable, in case this formula wraps a variable.
                         Constraint<Pol>, // The constraint, in case this formula wraps a constraint.
@@ -157,14 +161,8 @@ namespace carl {
             const FormulaContent<Pol> *mNegation = nullptr;
             /// The propositions of this formula.
             Condition mProperties;
-            /// Mutex for access to activity.
-            mutable std::mutex mActivityMutex;
-            /// Mutex for access to difficulty.
-            mutable std::mutex mDifficultyMutex;
-            /// Mutex for collecting the variables within this formula.
-            mutable std::mutex mCollectVariablesMutex;
-            /// Container collecting the variables which occur in this formula.
-            mutable Variables* mpVariables = nullptr;
+            /// Container collecting the variables which occur in this formula, computed on demand.
+            mutable std::atomic<Variables*> mpVariables = nullptr;
             
             FormulaContent() = delete;
             FormulaContent(const FormulaContent&) = delete;
@@ -230,8 +228,7 @@ namespace carl {
              */
             ~FormulaContent() {
                 // TODO NOTE: in case of true, false, bool: mContent was not destroyed ...
-                if( mpVariables != nullptr )
-                    delete mpVariables;
+                delete mpVariables.load();
             }
 
             std::size_t hash() const {
@@ -11,8 +11,11 @@
 #include "../core/VariablePool.h"
 #include "Formula.h"
 #include "ConstraintPool.h"
+#include <algorithm>
 #include <mutex>
 #include <limits>
+#include <set>
+#include <vector>
 #include <boost/variant.hpp>
 #include "bitvector/BVConstraintPool.h"
 #include "bitvector/BVConstraint.h"
@@ -41,6 +44,14 @@ namespace carl
             FastPointerSet<FormulaContent<Pol>> mPool;
             /// Mutex to avoid multiple access to the pool
             mutable std::recursive_mutex mMutexPool;
+            /// Contents whose usage dropped such that they may be deleted by the next reclamation.
+            std::vector<const FormulaContent<Pol>*> mDead;
+            /// Mutex to avoid multiple access to mDead
+            std::mutex mMutexDead;
+            /// The number of running calls to createRegistered(), reclamation is postponed until they are done.
+            std::size_t mCreating = 0;
+            /// Whether a reclamation is currently running.
+            bool mCollecting = false;
             ///
             FastPointerMap<FormulaContent<Pol>,const FormulaContent<Pol>*> mTseitinVars;
             ///
@@ -50,10 +61,12 @@ namespace carl
             #define FORMULA_POOL_LOCK_GUARD std::lock_guard<std::recursive_mutex> lock( mMutexPool );
             #define FORMULA_POOL_LOCK mMutexPool.lock();
             #define FORMULA_POOL_UNLOCK mMutexPool.unlock();
+            #define FORMULA_POOL_DEAD_LOCK_GUARD std::lock_guard<std::mutex> deadLock( mMutexDead );
             #else
             #define FORMULA_POOL_LOCK_GUARD
             #define FORMULA_POOL_LOCK
             #define FORMULA_POOL_UNLOCK
+            #define FORMULA_POOL_DEAD_LOCK_GUARD
             #endif
 
         protected:
@@ -77,10 +90,20 @@ namespace carl
             }
 
         public:
+            /// Number of dead contents after which they are reclaimed.
+            static constexpr std::size_t reclamationBatchSize = 256;
+
             std::size_t size() const {
                 return mPool.size();
             }
 
+            /**
+             * Deletes all contents that are no longer used by any formula.
+             * This happens automatically once reclamationBatchSize contents have died.
+             * Nothing is deleted while a formula is being created, such that its content and subformulas stay valid until it owns them.
+             */
+            void collectGarbage();
+
             void print() const
             {
                 std::cout << "Formula pool contains:" << std::endl;
@@ -110,16 +133,18 @@ namespace carl
 
             Formula<Pol> getTseitinVar( const Formula<Pol>& _formula )
             {
+                FORMULA_POOL_LOCK_GUARD
                 auto iter = mTseitinVars.find( _formula.mpContent );
                 if( iter != mTseitinVars.end() )
                 {
                     return Formula<Pol>( iter->second );
                 }
-                return trueFormula();
+                return Formula<Pol>( trueFormula() );
             }
 
             Formula<Pol> createTseitinVar( const Formula<Pol>& _formula )
             {
+                FORMULA_POOL_LOCK_GUARD
                 auto iter = mTseitinVars.insert( std::make_pair( _formula.mpContent, nullptr ) );
                 if( iter.second )
                 {
@@ -447,42 +472,94 @@ namespace carl
                 }
 			}
 
+            /**
+             * Decreases the usage of the given content.
+             * This does not lock the pool, unused contents are only queued and deleted in batches by collectGarbage().
+             * Only the last usage besides the negation is dropped while holding the dead list lock.
+             * A reclamation checks the usage under the same lock, hence it never deletes a content that is still accessed here.
+             */
             void free( const FormulaContent<Pol>* _elem )
             {
-                FORMULA_POOL_LOCK_GUARD
                 const FormulaContent<Pol>* tmp = getBaseFormula(_elem);
 				assert(tmp == getBaseFormula(tmp));
 				assert(isBaseFormula(tmp));
                 assert( tmp->mUsages > 0 );
-                --tmp->mUsages;
-				CARL_LOG_TRACE("carl.formula", "Usage of " << static_cast<const void*>(tmp) << " / " << static_cast<const void*>(tmp->mNegation) << " (coming from " << static_cast<const void*>(_elem) << "): " << tmp->mUsages);
-                if( tmp->mUsages == 1 )
+                std::size_t usages = tmp->mUsages.load();
+                while( usages > 2 )
+                {
+                    if( tmp->mUsages.compare_exchange_weak( usages, usages - 1 ) )
+                    {
+                        CARL_LOG_TRACE("carl.formula", "Usage of " << static_cast<const void*>(tmp) << " / " << static_cast<const void*>(tmp->mNegation) << " (coming from " << static_cast<const void*>(_elem) << "): " << (usages - 1));
+                        return;
+                    }
+                }
+                bool collect = false;
+                {
+                    FORMULA_POOL_DEAD_LOCK_GUARD
+                    usages = --tmp->mUsages;
+                    CARL_LOG_TRACE("carl.formula", "Usage of " << static_cast<const void*>(tmp) << " / " << static_cast<const void*>(tmp->mNegation) << " (coming from " << static_cast<const void*>(_elem) << "): " << usages);
+                    // The content is only referenced by its negation (or by nothing, if it is a constraint).
+                    if( usages == 1 && !tmp->mQueued )
+                    {
+                        tmp->mQueued = true;
+                        mDead.push_back( tmp );
+                        collect = mDead.size() >= reclamationBatchSize;
+                    }
+                }
+                if( collect )
+                    collectGarbage();
+            }
+
+            /**
+             * Checks whether the given content is only referenced by its negation and may hence be deleted by the running reclamation.
+             * If so, it is removed from the dead list.
+             */
+            bool unused( const FormulaContent<Pol>* _content )
+            {
+                FORMULA_POOL_DEAD_LOCK_GUARD
+                if( _content->mUsages != 1 )
+                    return false;
+                if( _content->mQueued )
+                {
+                    mDead.erase( std::remove( mDead.begin(), mDead.end(), _content ), mDead.end() );
+                    _content->mQueued = false;
+                }
+                return true;
+            }
+
+            /**
+             * Deletes the given unused content and its negation from the pool, unless it is still needed as a tseitin variable.
+             * The base contents of all deleted contents are added to the given set.
+             */
+            void reclaim( const FormulaContent<Pol>* tmp, std::set<const FormulaContent<Pol>*>& _deleted )
+            {
                 {
 					CARL_LOG_DEBUG("carl.formula", "Actually freeing " << *tmp << " from pool");
                     bool stillStoredAsTseitinVariable = false;
-                    if( freeTseitinVariable( tmp ) )
+                    if( freeTseitinVariable( tmp, _deleted ) )
                         stillStoredAsTseitinVariable = true;
-                    if( freeTseitinVariable( tmp->mNegation ) )
+                    if( freeTseitinVariable( tmp->mNegation, _deleted ) )
                         stillStoredAsTseitinVariable = true;
                     if( !stillStoredAsTseitinVariable )
                     {
 						CARL_LOG_TRACE("carl.formula", "Deleting " << tmp << " / " << tmp->mNegation << " from pool");
                         mPool.erase( tmp->mNegation );
 						mPool.erase( tmp );
+                        _deleted.insert( tmp );
                         delete tmp->mNegation;
                         delete tmp;
                     }
                 }
             }
 
-            bool freeTseitinVariable( const FormulaContent<Pol>* _toDelete )
+            bool freeTseitinVariable( const FormulaContent<Pol>* _toDelete, std::set<const FormulaContent<Pol>*>& _deleted )
             {
                 bool stillStoredAsTseitinVariable = false;
                 auto tvIter = mTseitinVars.find( _toDelete );
                 if( tvIter != mTseitinVars.end() )
                 {
                     // if this formula HAS a tseitin variable
-                    if( tvIter->second->mUsages == 1 )
+                    if( unused( tvIter->second ) )
                     {
                         // the tseitin variable is not used -> delete it
                         const FormulaContent<Pol>* tmp = tvIter->second;
@@ -491,6 +568,7 @@ namespace carl
                         mTseitinVarToFormula.erase( tmp );
 						CARL_LOG_TRACE("carl.formula", "Deleting " << static_cast<const void*>(tmp) << " / " << static_cast<const void*>(tmp->mNegation) << " from pool");
                         mPool.erase( tmp );
+                        _deleted.insert( tmp );
                         delete tmp->mNegation;
                         delete tmp;
                     }
@@ -504,7 +582,7 @@ namespace carl
                     {
                         const FormulaContent<Pol>* fcont = tmpTVIter->second->first;
                         // if this formula IS a tseitin variable
-                        if( fcont->mUsages == 1 )
+                        if( unused( fcont ) )
                         {
                             // the formula variable is not used -> delete it
                             const FormulaContent<Pol>* tmp = getBaseFormula(fcont);
@@ -513,6 +591,7 @@ namespace carl
                             mTseitinVarToFormula.erase( tmpTVIter );
 							CARL_LOG_TRACE("carl.formula", "Deleting " << static_cast<const void*>(tmp) << " / " << static_cast<const void*>(tmp->mNegation) << " from pool");
                             mPool.erase( tmp );
+                            _deleted.insert( tmp );
                             delete tmp->mNegation;
                             delete tmp;
                         }
@@ -523,15 +602,35 @@ namespace carl
                 return stillStoredAsTseitinVariable;
             }
 
-            void reg( const FormulaContent<Pol>* _elem ) const
+            /**
+             * Creates a content by the create() overload matching the given arguments and registers its usage.
+             * The pool is locked and reclamation is postponed until the usage is registered.
+             * Otherwise, the content could be deleted before the formula taking ownership registers it,
+             * for example if it has only been referenced by a subformula that is freed during its creation.
+             * @return The content, whose usage has already been increased.
+             */
+            template<typename... Args>
+            const FormulaContent<Pol>* createRegistered( Args&&... _args )
             {
                 FORMULA_POOL_LOCK_GUARD
+                ++mCreating;
+                const FormulaContent<Pol>* content = create( std::forward<Args>( _args )... );
+                if( content != nullptr )
+                    reg( content );
+                --mCreating;
+                return content;
+            }
+
+            /**
+             * Increases the usage of the given content. This does not lock the pool.
+             */
+            void reg( const FormulaContent<Pol>* _elem ) const
+            {
                 const FormulaContent<Pol>* tmp = getBaseFormula(_elem);
                 //const FormulaContent<Pol>* tmp = _elem->mType == FormulaType::NOT ? _elem->mNegation : _elem;
                 assert( tmp != nullptr );
                 assert( tmp->mUsages < std::numeric_limits<size_t>::max() );
-                ++tmp->mUsages;
-                if (tmp->mUsages == 1 && (tmp->mType == FormulaType::CONSTRAINT || tmp->mType == FormulaType::UEQ || tmp->mType == FormulaType::VARCOMPARE || tmp->mType == FormulaType::VARASSIGN)) {
+                if (tmp->mUsages++ == 0 && (tmp->mType == FormulaType::CONSTRAINT || tmp->mType == FormulaType::UEQ || tmp->mType == FormulaType::VARCOMPARE || tmp->mType == FormulaType::VARASSIGN)) {
                     CARL_LOG_TRACE("carl.formula", "Is a constraint, increasing again");
                     ++tmp->mUsages;
                 }
@@ -86,6 +86,47 @@ namespace carl
 		CARL_LOG_TRACE("carl.formula", "Returning " << static_cast<const void*>(*iterBoolPair.first));
         return *iterBoolPair.first;
     }
+
+    template<typename Pol>
+    void FormulaPool<Pol>::collectGarbage()
+    {
+        FORMULA_POOL_LOCK_GUARD
+        // Deleting a content frees its subformulas, which may queue further contents.
+        // These are handled by the loop below instead of a nested reclamation.
+        // A content created by createRegistered() is not registered yet, hence we wait until it is.
+        if( mCollecting || mCreating > 0 )
+            return;
+        mCollecting = true;
+        std::set<const FormulaContent<Pol>*> deleted;
+        std::vector<const FormulaContent<Pol>*> batch;
+        while( true )
+        {
+            {
+                FORMULA_POOL_DEAD_LOCK_GUARD
+                batch.swap( mDead );
+            }
+            if( batch.empty() )
+                break;
+            for( const FormulaContent<Pol>* content : batch )
+            {
+                // Already deleted as a tseitin variable of another content.
+                if( deleted.find( content ) != deleted.end() )
+                    continue;
+                bool dead = false;
+                {
+                    // free() drops the usage to one while holding this lock, hence it does not access the content anymore.
+                    // As we hold the pool lock, nobody can obtain a new usage of an unused content.
+                    FORMULA_POOL_DEAD_LOCK_GUARD
+                    content->mQueued = false;
+                    dead = content->mUsages == 1;
+                }
+                if( dead )
+                    reclaim( content, deleted );
+            }
+            batch.clear();
+        }
+        mCollecting = false;
+    }
     
     template<typename Pol>
     bool FormulaPool<Pol>::formulasInverse( const Formula<Pol>& _subformulaA, const Formula<Pol>& _subformulaB )
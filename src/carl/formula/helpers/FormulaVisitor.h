@@ -2,96 +2,81 @@
 
 #include "../Formula.h"
 
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 namespace carl {
 
 /**
  * This class provides a generic visitor for the above Formula class.
+ *
+ * Formulas are DAGs, hence a subformula may occur many times within a formula.
+ * The visitor traverses every distinct subformula (identified by its id) only once per call,
+ * hence visit() calls the function once per distinct subformula and not once per occurrence.
+ * Callers that count occurrences have to propagate their counts bottom-up, as Formula::complexity() does.
+ * The traversal uses an explicit stack instead of recursion, so deep formulas do not overflow the call stack.
+ * All state of a traversal is local to the respective call, hence the functions may visit other formulas themselves.
  */
 template<typename Formula>
 struct FormulaVisitor {
-	/**
-	 * Recursively calls func on every subformula.
-	 * @param formula Formula to visit.
-	 * @param func Function to call.
-	 */
-	void visit(const Formula& formula, const std::function<void(Formula)>& func) {
-		switch (formula.getType()) {
-			case AND:
-			case OR:
-			case IFF:
-			case XOR:
-			case IMPLIES:
-			case ITE:
-				for (const auto& cur: formula.subformulas()) visit(cur, func);
-				break;
-			case NOT:
-				visit(formula.subformula(), func);
-				break;
-			case BOOL:
-			case CONSTRAINT:
-			case VARCOMPARE:
-			case VARASSIGN:
-			case BITVECTOR:
-			case TRUE:
-			case FALSE:
-			case UEQ:
-				break;
-			case EXISTS:
-			case FORALL:
-				visit(formula.quantifiedFormula(), func);
-				break;
-		}
-		func(formula);
+private:
+	/// Stack of formulas to process, together with a flag whether their subformulas have already been pushed.
+	using Stack = std::vector<std::pair<const Formula*,bool>>;
+	/// Results of the formulas already visited, indexed by their ids.
+	using Results = std::unordered_map<std::size_t,Formula>;
+
+	static const Formula& result(const Results& results, const Formula& formula) {
+		auto it = results.find(formula.getId());
+		assert(it != results.end());
+		return it->second;
 	}
+
 	/**
-	 * Recursively calls func on every subformula and return a new formula.
-	 * On every call of func, the passed formula is replaced by the result.
-	 * @param formula Formula to visit.
-	 * @param func Function to call.
-	 * @return New formula.
+	 * Builds the formula obtained from the given one by replacing its direct subformulas by their results.
 	 */
-	Formula visitResult(const Formula& formula, const std::function<Formula(Formula)>& func) {
-		Formula newFormula = formula;
+	static Formula rebuild(const Results& results, const Formula& formula) {
 		switch (formula.getType()) {
 			case AND:
 			case OR:
 			case IFF:
 			case XOR: {
 				Formulas<typename Formula::PolynomialType> newSubformulas;
+				newSubformulas.reserve(formula.subformulas().size());
 				bool changed = false;
 				for (const auto& cur: formula.subformulas()) {
-					Formula newCur = visitResult(cur, func);
+					const Formula& newCur = result(results, cur);
 					if (newCur != cur) changed = true;
 					newSubformulas.push_back(newCur);
 				}
 				if (changed) {
-					newFormula = Formula(formula.getType(), std::move(newSubformulas));
+					return Formula(formula.getType(), std::move(newSubformulas));
 				}
-				break;
+				return formula;
 			}
 			case NOT: {
-				Formula cur = visitResult(formula.subformula(), func);
+				const Formula& cur = result(results, formula.subformula());
 				if (cur != formula.subformula()) {
-					newFormula = !cur;
+					return !cur;
 				}
-				break;
+				return formula;
 			}
 			case IMPLIES: {
-				Formula prem = visitResult(formula.premise(), func);
-				Formula conc = visitResult(formula.conclusion(), func);
+				const Formula& prem = result(results, formula.premise());
+				const Formula& conc = result(results, formula.conclusion());
 				if ((prem != formula.premise()) || (conc != formula.conclusion())) {
-					newFormula = Formula(IMPLIES, {prem, conc});
+					return Formula(IMPLIES, {prem, conc});
 				}
-				break;
+				return formula;
 			}
 			case ITE: {
-				Formula cond = visitResult(formula.condition(), func);
-				Formula fCase = visitResult(formula.firstCase(), func);
-				Formula sCase = visitResult(formula.secondCase(), func);
+				const Formula& cond = result(results, formula.condition());
+				const Formula& fCase = result(results, formula.firstCase());
+				const Formula& sCase = result(results, formula.secondCase());
 				if ((cond != formula.condition()) || (fCase != formula.firstCase()) || (sCase != formula.secondCase())) {
-					newFormula = Formula(ITE, {cond, fCase, sCase});
+					return Formula(ITE, {cond, fCase, sCase});
 				}
-				break;
+				return formula;
 			}
 			case BOOL:
 			case CONSTRAINT:
@@ -101,17 +86,117 @@ struct FormulaVisitor {
 			case TRUE:
 			case FALSE:
 			case UEQ:
-				break;
+				return formula;
 			case EXISTS:
 			case FORALL: {
-				Formula sub = visitResult(formula.quantifiedFormula(), func);
+				const Formula& sub = result(results, formula.quantifiedFormula());
 				if (sub != formula.quantifiedFormula()) {
-					newFormula = Formula(formula.getType(), formula.quantifiedVariables(), sub);
+					return Formula(formula.getType(), formula.quantifiedVariables(), sub);
 				}
+				return formula;
+			}
+		}
+		return formula;
+	}
+public:
+	/**
+	 * Calls func on every direct subformula of the given formula.
+	 * @param formula Formula.
+	 * @param func Function to call.
+	 */
+	template<typename Function>
+	static void forallSubformulas(const Formula& formula, Function&& func) {
+		switch (formula.getType()) {
+			case AND:
+			case OR:
+			case IFF:
+			case XOR:
+			case IMPLIES:
+			case ITE:
+				for (const auto& cur: formula.subformulas()) func(cur);
+				break;
+			case NOT:
+				func(formula.subformula());
+				break;
+			case BOOL:
+			case CONSTRAINT:
+			case VARCOMPARE:
+			case VARASSIGN:
+			case BITVECTOR:
+			case TRUE:
+			case FALSE:
+			case UEQ:
+				break;
+			case EXISTS:
+			case FORALL:
+				func(formula.quantifiedFormula());
 				break;
+		}
+	}
+
+	/**
+	 * Calls func on every distinct subformula, subformulas are visited before the formulas containing them.
+	 * Note that func is called only once for a subformula that occurs multiple times.
+	 * @param formula Formula to visit.
+	 * @param func Function to call.
+	 */
+	template<typename Function>
+	void visit(const Formula& formula, Function&& func) {
+		Stack stack;
+		std::unordered_set<std::size_t> visited;
+		stack.emplace_back(&formula, false);
+		while (!stack.empty()) {
+			auto [cur, expanded] = stack.back();
+			if (expanded) {
+				stack.pop_back();
+				func(*cur);
+				continue;
+			}
+			if (!visited.insert(cur->getId()).second) {
+				stack.pop_back();
+				continue;
+			}
+			stack.back().second = true;
+			forallSubformulas(*cur, [&stack, &visited](const Formula& sub) {
+				if (visited.find(sub.getId()) == visited.end()) {
+					stack.emplace_back(&sub, false);
+				}
+			});
+		}
+	}
+	/**
+	 * Calls func on every distinct subformula and return a new formula.
+	 * On every call of func, the passed formula is replaced by the result.
+	 * The result for a subformula is computed once and reused for all its occurrences.
+	 * @param formula Formula to visit.
+	 * @param func Function to call.
+	 * @return New formula.
+	 */
+	template<typename Function>
+	Formula visitResult(const Formula& formula, Function&& func) {
+		Stack stack;
+		Results results;
+		stack.emplace_back(&formula, false);
+		while (!stack.empty()) {
+			auto [cur, expanded] = stack.back();
+			if (results.find(cur->getId()) != results.end()) {
+				stack.pop_back();
+				continue;
 			}
+			if (expanded) {
+				stack.pop_back();
+				Formula newFormula = rebuild(results, *cur);
+				results.emplace(cur->getId(), func(newFormula));
+				continue;
+			}
+			stack.back().second = true;
+			forallSubformulas(*cur, [&stack, &results](const Formula& sub) {
+				if (results.find(sub.getId()) == results.end()) {
+					stack.emplace_back(&sub, false);
+				}
+			});
 		}
-		return func(newFormula);
+		return result(results, formula);
 	}
 };
 
@@ -168,19 +253,19 @@ public:
 
 	Formula substitute(const Formula& formula, const std::map<Formula,Formula>& replacements) {
 		Substitutor subs(replacements);
-		return visitor.visitResult(formula, std::function<Formula(Formula)>(subs));
+		return visitor.visitResult(formula, subs);
 	}
 	Formula substitute(const Formula& formula, const std::map<Variable,typename Formula::PolynomialType>& replacements) {
 		PolynomialSubstitutor subs(replacements);
-		return visitor.visitResult(formula, std::function<Formula(Formula)>(subs));
+		return visitor.visitResult(formula, subs);
 	}
 	Formula substitute(const Formula& formula, const std::map<BVVariable,BVTerm>& replacements) {
 		BitvectorSubstitutor subs(replacements);
-		return visitor.visitResult(formula, std::function<Formula(Formula)>(subs));
+		return visitor.visitResult(formula, subs);
 	}
 	Formula substitute(const Formula& formula, const std::map<UVariable,UFInstance>& replacements) {
 		UninterpretedSubstitutor subs(replacements);
-		return visitor.visitResult(formula, std::function<Formula(Formula)>(subs));
+		return visitor.visitResult(formula, subs);
 	}
 };
 
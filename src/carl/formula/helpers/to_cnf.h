@@ -2,6 +2,11 @@
 
 #include "../Formula.h"
 
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 namespace carl {
 namespace formula_to_cnf {
 
@@ -31,10 +36,11 @@ using ConstraintBounds = FastMap<Poly, std::map<typename Poly::NumberType, std::
 
 /**
  * Converts an OR to cnf.
- * 
+ * If encoded is given, tseitin variables of formulas from this set are reused without adding their definition again.
+ * Newly defined formulas are added to encoded.
  */
 template<typename Poly>
-Formula<Poly> to_cnf_or(const Formula<Poly>& f, bool keep_constraints, bool simplify_combinations, bool tseitin_equivalence, TseitinConstraints<Poly>& tseitin) {
+Formula<Poly> to_cnf_or(const Formula<Poly>& f, bool keep_constraints, bool simplify_combinations, bool tseitin_equivalence, TseitinConstraints<Poly>& tseitin, std::unordered_set<Formula<Poly>>* encoded = nullptr) {
 	// Checks for immediate tautologies among constraints
 	ConstraintBounds<Poly> constraint_bounds;
 	// Resulting subformulas
@@ -124,10 +130,12 @@ Formula<Poly> to_cnf_or(const Formula<Poly>& f, bool keep_constraints, bool simp
 			case FormulaType::AND: {
 				// Replace by a fresh tseitin variable.
 				auto tseitinVar = FormulaPool<Poly>::getInstance().createTseitinVar(current);
-				if (tseitin_equivalence) {
-					tseitin.emplace_back(Formula<Poly>(FormulaType::IFF, { tseitinVar, current }));
-				} else {
-					tseitin.emplace_back(Formula<Poly>(FormulaType::IMPLIES, { tseitinVar, current }));
+				if (encoded == nullptr || encoded->insert(current).second) {
+					if (tseitin_equivalence) {
+						tseitin.emplace_back(Formula<Poly>(FormulaType::IFF, { tseitinVar, current }));
+					} else {
+						tseitin.emplace_back(Formula<Poly>(FormulaType::IMPLIES, { tseitinVar, current }));
+					}
 				}
 				subformulas.emplace_back(tseitinVar);
 				break;
@@ -150,33 +158,17 @@ Formula<Poly> to_cnf_or(const Formula<Poly>& f, bool keep_constraints, bool simp
 	return Formula<Poly>(FormulaType::OR, std::move(subformulas));
 }
 
-}
 
 /**
- * Converts the given formula to CNF.
- * @param f Formula to convert.
- * @param keep_constraints Indicates whether to keep constraints or allow to change them in resolveNegation().
- * @param simplify_combinations Indicates whether we attempt to simplify combinations of constraints with ConstraintBounds.
- * @param tseitin_equivalence Indicates whether we use implications or equivalences for tseitin variables.
- * @return The formula in CNF.
+ * Splits the given formula into clauses, i.e. literals and disjunctions of literals, introducing tseitin variables as necessary.
+ * Every clause is passed to the given callback as soon as it is known, the conjunction of all clauses is equisatisfiable to f.
+ * An unsatisfiable clause is passed as FALSE, valid clauses are omitted.
+ * @param clause Callback for the clauses, returning false aborts the conversion.
+ * @param encoded If given, tseitin definitions of formulas from this set are not generated again, see to_cnf_or().
+ * @return false, if the callback aborted the conversion.
  */
-template<typename Poly>
-Formula<Poly> to_cnf(const Formula<Poly>& f, bool keep_constraints = true, bool simplify_combinations = false, bool tseitin_equivalence = true) {
-	if (!simplify_combinations && f.propertyHolds(PROP_IS_IN_CNF)) {
-		if (keep_constraints) {
-			return f;
-		} else if (f.getType() == FormulaType::NOT) {
-			assert(f.isLiteral());
-			return f.resolveNegation(keep_constraints);
-		}
-	} else if (f.isAtom()) {
-		return f;
-	}
-
-	// Checks for immediate conflicts among constraints
-	formula_to_cnf::ConstraintBounds<Poly> constraint_bounds;
-	// Resulting subformulas
-	Formulas<Poly> subformulas;
+template<typename Poly, typename Callback>
+bool to_clauses(const Formula<Poly>& f, bool keep_constraints, bool simplify_combinations, bool tseitin_equivalence, std::unordered_set<Formula<Poly>>* encoded, Callback&& clause) {
 	// Queue of subformulas to process
 	std::vector<Formula<Poly>> subformula_queue = { f };
 	while (!subformula_queue.empty()) {
@@ -188,30 +180,19 @@ Formula<Poly> to_cnf(const Formula<Poly>& f, bool keep_constraints = true, bool
 			case FormulaType::TRUE:
 				break;
 			case FormulaType::FALSE:
-				return Formula<Poly>(FormulaType::FALSE);
 			case FormulaType::BITVECTOR:
 			case FormulaType::BOOL:
 			case FormulaType::UEQ:
 			case FormulaType::VARASSIGN:
 			case FormulaType::VARCOMPARE:
-				subformulas.emplace_back(current);
-				break;
 			case FormulaType::CONSTRAINT:
-				// Try simplification with ConstraintBounds
-				if (simplify_combinations) {
-					if (Formula<Poly>::addConstraintBound(constraint_bounds, current, true).isFalse()) {
-						CARL_LOG_DEBUG("carl.formula.cnf", "Adding " << current << " to constraint bounds yielded a conflict");
-						return Formula<Poly>(FormulaType::FALSE);
-					}
-				} else {
-					subformulas.emplace_back(current);
-				}
+				if (!clause(current)) return false;
 				break;
 			case FormulaType::NOT: {
 				// Resolve negation
 				auto resolved = current.resolveNegation(keep_constraints);
 				if (resolved.isLiteral()) {
-					subformulas.emplace_back(resolved);
+					if (!clause(resolved)) return false;
 				} else {
 					subformula_queue.emplace_back(resolved);
 				}
@@ -237,10 +218,10 @@ Formula<Poly> to_cnf(const Formula<Poly>& f, bool keep_constraints = true, bool
 					const auto& lhs = current.subformulas().front();
 					const auto& rhs = current.subformulas().back();
 					if (lhs.getType() == FormulaType::AND) {
-						auto tmp = formula_to_cnf::construct_iff(rhs, lhs.subformulas());
+						auto tmp = construct_iff(rhs, lhs.subformulas());
 						subformula_queue.insert(subformula_queue.end(), tmp.begin(), tmp.end());
 					} else if (rhs.getType() == FormulaType::AND) {
-						auto tmp = formula_to_cnf::construct_iff(lhs, rhs.subformulas());
+						auto tmp = construct_iff(lhs, rhs.subformulas());
 						subformula_queue.insert(subformula_queue.end(), tmp.begin(), tmp.end());
 					} else {
 						// (iff A B) -> (or !A B), (or A !B)
@@ -277,13 +258,10 @@ Formula<Poly> to_cnf(const Formula<Poly>& f, bool keep_constraints = true, bool
 				break;
 			case FormulaType::OR: {
 				// Call to_cnf_or() to obtain a clause of literals res and the newly created tseitin variables defined in tseitin.
-				formula_to_cnf::TseitinConstraints<Poly> tseitin;
-				auto res = formula_to_cnf::to_cnf_or(current, keep_constraints, simplify_combinations, tseitin_equivalence, tseitin);
-				if (res.isFalse()) {
-					return Formula<Poly>(FormulaType::FALSE);
-				}
+				TseitinConstraints<Poly> tseitin;
+				auto res = to_cnf_or(current, keep_constraints, simplify_combinations, tseitin_equivalence, tseitin, encoded);
+				if (!res.isTrue() && !clause(res)) return false;
 				subformula_queue.insert(subformula_queue.end(), tseitin.begin(), tseitin.end());
-				subformulas.emplace_back(res);
 				break;
 			}
 			case FormulaType::EXISTS:
@@ -293,6 +271,56 @@ Formula<Poly> to_cnf(const Formula<Poly>& f, bool keep_constraints = true, bool
 				break;
 		}
 	}
+	return true;
+}
+
+}
+
+/**
+ * Converts the given formula to CNF.
+ * @param f Formula to convert.
+ * @param keep_constraints Indicates whether to keep constraints or allow to change them in resolveNegation().
+ * @param simplify_combinations Indicates whether we attempt to simplify combinations of constraints with ConstraintBounds.
+ * @param tseitin_equivalence Indicates whether we use implications or equivalences for tseitin variables.
+ * @return The formula in CNF.
+ */
+template<typename Poly>
+Formula<Poly> to_cnf(const Formula<Poly>& f, bool keep_constraints = true, bool simplify_combinations = false, bool tseitin_equivalence = true) {
+	if (!simplify_combinations && f.propertyHolds(PROP_IS_IN_CNF)) {
+		if (keep_constraints) {
+			return f;
+		} else if (f.getType() == FormulaType::NOT) {
+			assert(f.isLiteral());
+			return f.resolveNegation(keep_constraints);
+		}
+	} else if (f.isAtom()) {
+		return f;
+	}
+
+	// Checks for immediate conflicts among constraints
+	formula_to_cnf::ConstraintBounds<Poly> constraint_bounds;
+	// Resulting subformulas
+	Formulas<Poly> subformulas;
+	bool consistent = formula_to_cnf::to_clauses<Poly>(f, keep_constraints, simplify_combinations, tseitin_equivalence, nullptr,
+		[&](const Formula<Poly>& clause) {
+			if (clause.isFalse()) {
+				return false;
+			}
+			if (simplify_combinations && clause.getType() == FormulaType::CONSTRAINT) {
+				// Try simplification with ConstraintBounds
+				if (Formula<Poly>::addConstraintBound(constraint_bounds, clause, true).isFalse()) {
+					CARL_LOG_DEBUG("carl.formula.cnf", "Adding " << clause << " to constraint bounds yielded a conflict");
+					return false;
+				}
+				return true;
+			}
+			subformulas.emplace_back(clause);
+			return true;
+		}
+	);
+	if (!consistent) {
+		return Formula<Poly>(FormulaType::FALSE);
+	}
 	if (simplify_combinations && Formula<Poly>::swapConstraintBounds(constraint_bounds, subformulas, true)) {
 		return Formula<Poly>(FormulaType::FALSE);
 	} else if (subformulas.empty()) {
@@ -303,4 +331,120 @@ Formula<Poly> to_cnf(const Formula<Poly>& f, bool keep_constraints = true, bool
 	return Formula<Poly>(FormulaType::AND, std::move(subformulas));
 }
 
-}
\ No newline at end of file
+/**
+ * Converts formulas to CNF incrementally.
+ * Formulas are added one at a time and the resulting clauses are passed to the sink as soon as they are known,
+ * hence the conjunction of all clauses is never built.
+ * Tseitin variables are obtained from the FormulaPool and are thus shared between all added formulas,
+ * the definition of a tseitin variable is only generated when it is first used by this encoder.
+ */
+template<typename Poly>
+class CNFEncoder {
+public:
+	/// Receives clauses, i.e. literals or disjunctions of literals. An unsatisfiable clause is given as FALSE.
+	using ClauseSink = std::function<void(const Formula<Poly>&)>;
+private:
+	ClauseSink mSink;
+	bool mKeepConstraints;
+	bool mTseitinEquivalence;
+	/// Formulas whose tseitin variables have been defined by this encoder.
+	std::unordered_set<Formula<Poly>> mEncoded;
+	/// Number of clauses passed to the sink.
+	std::size_t mClauses = 0;
+public:
+	/**
+	 * @param sink Receiver of the clauses.
+	 * @param keep_constraints Indicates whether to keep constraints or allow to change them in resolveNegation().
+	 * @param tseitin_equivalence Indicates whether we use implications or equivalences for tseitin variables.
+	 */
+	explicit CNFEncoder(ClauseSink sink, bool keep_constraints = true, bool tseitin_equivalence = true):
+		mSink(std::move(sink)),
+		mKeepConstraints(keep_constraints),
+		mTseitinEquivalence(tseitin_equivalence)
+	{}
+
+	/**
+	 * Converts the given formula to clauses and passes them to the sink.
+	 */
+	void add(const Formula<Poly>& f) {
+		formula_to_cnf::to_clauses(f, mKeepConstraints, false, mTseitinEquivalence, &mEncoded,
+			[this](const Formula<Poly>& clause) {
+				++mClauses;
+				mSink(clause);
+				return true;
+			}
+		);
+	}
+
+	std::size_t clauses() const {
+		return mClauses;
+	}
+
+	/**
+	 * Forgets which tseitin variables have been defined, e.g. if the receiver of the clauses has been reset.
+	 */
+	void clear() {
+		mEncoded.clear();
+		mClauses = 0;
+	}
+};
+
+/**
+ * Translates clauses to flat arrays of integer literals as used by DIMACS and most SAT solvers.
+ * Every atom is assigned a positive id starting from one, negated atoms are given by the negative id.
+ * It can be used as the sink of a CNFEncoder.
+ */
+template<typename Poly>
+class CNFLiteralMap {
+public:
+	/// Receives the literals of a clause and their number, which is zero for an unsatisfiable clause.
+	using LiteralSink = std::function<void(const int*, std::size_t)>;
+private:
+	LiteralSink mSink;
+	std::unordered_map<Formula<Poly>,int> mIds;
+	std::vector<Formula<Poly>> mAtoms;
+	/// Buffer for the current clause.
+	std::vector<int> mClause;
+
+	int literal(const Formula<Poly>& f) {
+		if (f.getType() == FormulaType::NOT) {
+			return -literal(f.subformula());
+		}
+		auto it = mIds.try_emplace(f, static_cast<int>(mAtoms.size()) + 1);
+		if (it.second) {
+			mAtoms.push_back(f);
+		}
+		return it.first->second;
+	}
+public:
+	explicit CNFLiteralMap(LiteralSink sink): mSink(std::move(sink)) {}
+
+	void operator()(const Formula<Poly>& clause) {
+		mClause.clear();
+		if (clause.getType() == FormulaType::OR) {
+			for (const auto& sub: clause.subformulas()) {
+				mClause.push_back(literal(sub));
+			}
+		} else if (!clause.isFalse()) {
+			mClause.push_back(literal(clause));
+		}
+		mSink(mClause.data(), mClause.size());
+	}
+
+	/**
+	 * @return The atom with the given positive id.
+	 */
+	const Formula<Poly>& atom(int id) const {
+		assert(id > 0 && static_cast<std::size_t>(id) <= mAtoms.size());
+		return mAtoms[static_cast<std::size_t>(id) - 1];
+	}
+
+	/**
+	 * @return The number of atoms.
+	 */
+	std::size_t size() const {
+		return mAtoms.size();
+	}
+};
+
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <carl/core/MultivariatePolynomial.h>
+#include <carl/core/Sign.h>
+#include <carl/core/UnivariatePolynomial.h>
+#include <carl/core/Variable.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <optional>
+#include <vector>
+
+namespace carl::ran::interval {
+
+/**
+ * A closed interval of doubles enclosing some real number, used as a cheap filter before exact computations.
+ * Every operation rounds its result outwards by one ulp, hence the result encloses the exact result without changing the rounding mode.
+ * Overflows yield infinite bounds and invalid operations yield NaN, both of which make the filter inconclusive.
+ */
+struct double_interval {
+	double lower;
+	double upper;
+
+	static double down(double d) {
+		return std::nextafter(d, -std::numeric_limits<double>::infinity());
+	}
+	static double up(double d) {
+		return std::nextafter(d, std::numeric_limits<double>::infinity());
+	}
+	/// Returns an interval containing the whole real line, used if the result is undefined.
+	static double_interval unbounded() {
+		return { -std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity() };
+	}
+	/// Returns an interval enclosing n.
+	template<typename Number>
+	static double_interval enclose(const Number& n) {
+		double d = carl::toDouble(n);
+		return { down(d), up(d) };
+	}
+
+	bool contains_zero() const {
+		return !(lower > 0 || upper < 0);
+	}
+	/// Returns the sign of all numbers in this interval, or std::nullopt if it is not determined.
+	std::optional<Sign> sign() const {
+		if (lower > 0) return Sign::POSITIVE;
+		if (upper < 0) return Sign::NEGATIVE;
+		return std::nullopt;
+	}
+};
+
+inline double_interval operator+(const double_interval& lhs, const double_interval& rhs) {
+	return { double_interval::down(lhs.lower + rhs.lower), double_interval::up(lhs.upper + rhs.upper) };
+}
+
+inline double_interval operator*(const double_interval& lhs, const double_interval& rhs) {
+	double p[4] = { lhs.lower * rhs.lower, lhs.lower * rhs.upper, lhs.upper * rhs.lower, lhs.upper * rhs.upper };
+	if (std::any_of(std::begin(p), std::end(p), [](double d){ return std::isnan(d); })) {
+		return double_interval::unbounded();
+	}
+	auto [min, max] = std::minmax_element(std::begin(p), std::end(p));
+	return { double_interval::down(*min), double_interval::up(*max) };
+}
+
+inline double_interval pow(const double_interval& base, std::size_t exp) {
+	double_interval b = base;
+	if (exp % 2 == 0 && exp > 0) {
+		// Even powers are non-negative, use the absolute values.
+		double l = std::abs(base.lower);
+		double u = std::abs(base.upper);
+		b = { base.contains_zero() ? 0.0 : std::min(l, u), std::max(l, u) };
+	}
+	double_interval res = { 1, 1 };
+	for (std::size_t i = 0; i < exp; ++i) {
+		res = res * b;
+	}
+	return res;
+}
+
+/// Returns the sign of lhs - rhs, if the intervals are disjoint.
+inline std::optional<Sign> compare(const double_interval& lhs, const double_interval& rhs) {
+	if (lhs.upper < rhs.lower) return Sign::NEGATIVE;
+	if (lhs.lower > rhs.upper) return Sign::POSITIVE;
+	return std::nullopt;
+}
+
+/// Returns enclosures of the coefficients of p.
+template<typename Number>
+std::vector<double_interval> enclose_coefficients(const UnivariatePolynomial<Number>& p) {
+	std::vector<double_interval> res;
+	res.reserve(p.coefficients().size());
+	for (const auto& c: p.coefficients()) {
+		res.emplace_back(double_interval::enclose(c));
+	}
+	return res;
+}
+
+/// Evaluates the polynomial with the given coefficients on x using Horner's scheme.
+inline double_interval evaluate(const std::vector<double_interval>& coeffs, const double_interval& x) {
+	if (coeffs.empty()) return { 0, 0 };
+	double_interval res = coeffs.back();
+	for (std::size_t i = coeffs.size() - 1; i > 0; --i) {
+		res = res * x + coeffs[i-1];
+	}
+	return res;
+}
+
+/// Evaluates p on x using Horner's scheme.
+template<typename Number>
+double_interval evaluate(const UnivariatePolynomial<Number>& p, const double_interval& x) {
+	return evaluate(enclose_coefficients(p), x);
+}
+
+/**
+ * Evaluates p on the given intervals for its variables.
+ * Returns std::nullopt if a variable of p has no interval.
+ */
+template<typename Coeff, typename Ordering, typename Policies>
+std::optional<double_interval> evaluate(const MultivariatePolynomial<Coeff, Ordering, Policies>& p, const std::map<Variable, double_interval>& m) {
+	double_interval res = { 0, 0 };
+	for (const auto& term: p) {
+		double_interval t = double_interval::enclose(term.coeff());
+		if (term.monomial()) {
+			for (const auto& [var, exp]: term.monomial()->exponents()) {
+				auto it = m.find(var);
+				if (it == m.end()) return std::nullopt;
+				t = t * pow(it->second, exp);
+			}
+		}
+		res = res + t;
+	}
+	return res;
+}
+
+}
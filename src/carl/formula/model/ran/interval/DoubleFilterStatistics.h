@@ -0,0 +1,41 @@
+#pragma once
+
+#include <carl-statistics/carl-statistics.h>
+
+#ifdef CARL_DEVOPTION_Statistics
+
+namespace carl {
+namespace ran {
+namespace interval {
+
+/**
+ * Counts how often the double filter decides an operation on real algebraic numbers (hit)
+ * and how often the exact computation is necessary (miss).
+ */
+class DoubleFilterStatistics : public statistics::Statistics {
+public:
+    std::size_t compareHits = 0;
+    std::size_t compareMisses = 0;
+    std::size_t sgnHits = 0;
+    std::size_t sgnMisses = 0;
+    std::size_t evaluateHits = 0;
+    std::size_t evaluateMisses = 0;
+    void collect() {
+        Statistics::addKeyValuePair("compare_hits", compareHits);
+        Statistics::addKeyValuePair("compare_misses", compareMisses);
+        Statistics::addKeyValuePair("sgn_hits", sgnHits);
+        Statistics::addKeyValuePair("sgn_misses", sgnMisses);
+        Statistics::addKeyValuePair("evaluate_hits", evaluateHits);
+        Statistics::addKeyValuePair("evaluate_misses", evaluateMisses);
+    }
+};
+
+static auto& filter_statistics() {
+    static CARL_INIT_STATISTICS(DoubleFilterStatistics, stats, "ran_double_filter");
+    return stats;
+}
+
+}
+}
+}
+#endif
\ No newline at end of file
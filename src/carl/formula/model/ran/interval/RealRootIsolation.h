@@ -11,16 +11,41 @@
 #include <carl/core/polynomialfunctions/EigenWrapper.h>
 #include <carl/core/polynomialfunctions/Evaluation.h>
 #include <carl/core/polynomialfunctions/RootElimination.h>
+#include <carl/core/polynomialfunctions/RootCounting.h>
+#include <carl/core/polynomialfunctions/SturmSequence.h>
+
+#include <deque>
+#include <optional>
 
 namespace carl::ran::interval {
 
 using carl::operator<<;
 
+/// Strategies to isolate the real roots within an interval.
+enum class IsolationStrategy {
+	/// Bisection, bounding the number of roots of every interval with Descartes' rule of signs.
+	Bisection,
+	/// Descartes' method (Vincent-Collins-Akritas), transforming the polynomial incrementally while bisecting.
+	VCA,
+	/// Bisection, counting the roots of every interval with a cached Sturm sequence.
+	Sturm
+};
+
+inline std::ostream& operator<<(std::ostream& os, IsolationStrategy s) {
+	switch (s) {
+		case IsolationStrategy::Bisection: return os << "Bisection";
+		case IsolationStrategy::VCA: return os << "VCA";
+		case IsolationStrategy::Sturm: return os << "Sturm";
+	}
+	return os << "Unknown";
+}
+
 /**
  * Compact class to isolate real roots from a univariate polynomial using bisection.
  * 
  * After some rather easy preprocessing (make polynomial square-free, eliminate zero roots, solve low-degree polynomial trivially, use root bounds to shrink the interval) 
  * we employ bisection which can optionally be initialized by approximations.
+ * The intervals are either checked using Descartes' rule of signs or Sturm sequences, see IsolationStrategy.
  */
 template<typename Number>
 class RealRootIsolation {
@@ -35,20 +60,22 @@ class RealRootIsolation {
 	std::vector<RealAlgebraicNumber<Number>> mRoots;
 	/// The bounding interval.
 	Interval<Number> mInterval;
+	/// The strategy used to isolate the roots.
+	IsolationStrategy mStrategy;
 	/// The sturm sequence for mPolynomial.
-	// std::optional<std::vector<UnivariatePolynomial<Number>>> mSturmSequence;
+	std::optional<std::vector<UnivariatePolynomial<Number>>> mSturmSequence;
 
 	/// Return the sturm sequence for mPolynomial, create it if necessary.
-	// const auto& sturm_sequence() {
-	// 	if (!mSturmSequence) {
-	// 		mSturmSequence = carl::sturm_sequence(mPolynomial);
-	// 	}
-	// 	return *mSturmSequence;
-	// }
+	const auto& sturm_sequence() {
+		if (!mSturmSequence) {
+			mSturmSequence = carl::sturm_sequence(mPolynomial);
+		}
+		return *mSturmSequence;
+	}
 	/// Reset the sturm sequence, used if the polynomial was modified.
-	// void reset_sturm_sequence() {
-	// 	mSturmSequence.reset();
-	// }
+	void reset_sturm_sequence() {
+		mSturmSequence.reset();
+	}
 
 	/// Handle zero roots (p(0) == 0)
 	void eliminate_zero_roots() {
@@ -133,7 +160,7 @@ class RealRootIsolation {
 	void add_root(const Number& n) {
 		CARL_LOG_TRACE("carl.core.rootfinder", "Add root " << n);
 		assert(carl::is_root_of(mPolynomial, n));
-		// reset_sturm_sequence();
+		reset_sturm_sequence();
 		eliminate_root(mPolynomial, n);
 		mRoots.emplace_back(n);
 	}
@@ -143,18 +170,39 @@ class RealRootIsolation {
 		mRoots.emplace_back(mPolynomial, i);
 	}
 
-	/// Check whether the interval bounds are roots.
+	/// Divide a root on a strict bound of mInterval out of mPolynomial without adding it to mRoots.
+	void eliminate_excluded_root(const Number& n) {
+		CARL_LOG_TRACE("carl.core.rootfinder", "Eliminate root " << n << " on a strict bound");
+		assert(carl::is_root_of(mPolynomial, n));
+		reset_sturm_sequence();
+		eliminate_root(mPolynomial, n);
+	}
+
+	/**
+	 * Check whether the interval bounds are roots.
+	 * Roots on weak bounds are added, roots on strict bounds are only divided out.
+	 * Afterwards, no interval used for bisection has a root of mPolynomial as an endpoint.
+	 * This is necessary as the Sturm sequence also counts a root on the upper endpoint.
+	 */
 	bool check_interval_bounds() {
 		bool found_root = false;
-		if (mInterval.lowerBoundType() == BoundType::WEAK) {
+		if (mInterval.lowerBoundType() != BoundType::INFTY) {
 			if (carl::is_root_of(mPolynomial, mInterval.lower())) {
-				add_root(mInterval.lower());
+				if (mInterval.lowerBoundType() == BoundType::WEAK) {
+					add_root(mInterval.lower());
+				} else {
+					eliminate_excluded_root(mInterval.lower());
+				}
 				found_root = true;
 			}
 		}
-		if (mInterval.upperBoundType() == BoundType::WEAK) {
+		if (mInterval.upperBoundType() != BoundType::INFTY) {
 			if (carl::is_root_of(mPolynomial, mInterval.upper())) {
-				add_root(mInterval.upper());
+				if (mInterval.upperBoundType() == BoundType::WEAK) {
+					add_root(mInterval.upper());
+				} else {
+					eliminate_excluded_root(mInterval.upper());
+				}
 				found_root = true;
 			}
 		}
@@ -240,7 +288,11 @@ class RealRootIsolation {
 			auto cur = queue.front();
 			queue.pop_front();
 
-			auto variations = carl::sign_variations(mPolynomial, cur);
+			// Sturm sequences count the roots in (lower, upper], hence upper must not be a root.
+			assert(mStrategy != IsolationStrategy::Sturm || !carl::is_root_of(mPolynomial, cur.upper()));
+			auto variations = (mStrategy == IsolationStrategy::Sturm) ?
+				static_cast<uint>(count_real_roots(sturm_sequence(), cur)) :
+				carl::sign_variations(mPolynomial, cur);
 			
 			if (variations == 0) {
 				CARL_LOG_DEBUG("carl.core.rootfinder", "No root within " << cur);
@@ -265,6 +317,110 @@ class RealRootIsolation {
 		}
 	}
 
+	/// Apply x -> x+1 to the polynomial given by its coefficients.
+	static void shift_by_one(std::vector<Number>& coeffs) {
+		std::size_t n = coeffs.size() - 1;
+		for (std::size_t i = 0; i < n; ++i) {
+			for (std::size_t j = n - 1; ; --j) {
+				coeffs[j] += coeffs[j+1];
+				if (j == i) break;
+			}
+		}
+	}
+	/// Apply x -> x/2 to the polynomial given by its coefficients and multiply by 2^n to stay integral.
+	static void halve(std::vector<Number>& coeffs) {
+		Number factor = 1;
+		for (std::size_t i = coeffs.size(); i > 0; --i) {
+			coeffs[i-1] *= factor;
+			factor *= 2;
+		}
+	}
+	/**
+	 * Divide the coefficients by their content, which keeps them small during Descartes' method.
+	 * Halving multiplies the coefficients by powers of two that often become common factors, while shifting by one preserves the content.
+	 */
+	static void remove_content(std::vector<Number>& coeffs) {
+		Number content = 0;
+		for (const auto& c: coeffs) {
+			if (carl::isZero(c)) continue;
+			content = carl::isZero(content) ? carl::abs(c) : carl::gcd(content, c);
+			if (carl::isOne(content)) return;
+		}
+		if (carl::isZero(content)) return;
+		for (auto& c: coeffs) c /= content;
+	}
+	/// Upper bound for the number of roots in (0,1) from Descartes' rule of signs, applied to (x+1)^n p(1/(x+1)).
+	static uint descartes_bound(const std::vector<Number>& coeffs) {
+		std::vector<Number> tmp(coeffs.rbegin(), coeffs.rend());
+		shift_by_one(tmp);
+		return carl::sign_variations(tmp.begin(), tmp.end(), [](const auto& c){ return carl::sgn(c); });
+	}
+
+	/**
+	 * Perform Descartes' method, also known as Vincent-Collins-Akritas.
+	 *
+	 * Every interval (l, l+w) is represented by a polynomial q with q(x) = c * p(l + w*x), whose roots in (0,1) are the roots of p in the interval.
+	 * Bisecting the interval yields q(x/2) and q((x+1)/2), hence the polynomials of subintervals only need scaling by powers of two and shifts by one.
+	 * Compared to bisection, we avoid transforming p for every interval which involves shifts by arbitrary rationals.
+	 * The coefficients stay integral after the initial transformation.
+	 */
+	void isolate_by_descartes() {
+		std::deque<Interval<Number>> queue;
+		if (initialize_bisection_by_approximation) {
+			bisect_by_approximation(queue);
+		} else {
+			queue.emplace_back(mInterval);
+		}
+
+		/// The polynomial q for the interval (lower, lower+width).
+		struct Node {
+			std::vector<Number> coeffs;
+			Number lower;
+			Number width;
+		};
+		std::vector<Node> stack;
+		for (const auto& cur: queue) {
+			auto q = detail_sign_variations::shift(mPolynomial, cur.lower());
+			q = detail_sign_variations::scale(std::move(q), cur.diameter());
+			std::vector<Number> coeffs(std::move(q.coefficients()));
+			remove_content(coeffs);
+			stack.push_back(Node{ std::move(coeffs), cur.lower(), cur.diameter() });
+		}
+
+		while (!stack.empty()) {
+			Node cur = std::move(stack.back());
+			stack.pop_back();
+
+			auto variations = descartes_bound(cur.coeffs);
+			if (variations == 0) {
+				CARL_LOG_DEBUG("carl.core.rootfinder", "No root within (" << cur.lower << ", " << cur.lower + cur.width << ")");
+				continue;
+			}
+			Interval<Number> interval(cur.lower, BoundType::STRICT, cur.lower + cur.width, BoundType::STRICT);
+			if (variations == 1) {
+				CARL_LOG_DEBUG("carl.core.rootfinder", "A single root within " << interval);
+				assert(!carl::is_root_of(mPolynomial, interval.lower()));
+				assert(!carl::is_root_of(mPolynomial, interval.upper()));
+				add_root(interval);
+				continue;
+			}
+
+			Node left{ std::move(cur.coeffs), cur.lower, cur.width / 2 };
+			halve(left.coeffs);
+			remove_content(left.coeffs);
+			Node right{ left.coeffs, cur.lower + left.width, left.width };
+			shift_by_one(right.coeffs);
+			CARL_LOG_DEBUG("carl.core.rootfinder", "Splitting " << interval << " at " << right.lower);
+			if (carl::isZero(right.coeffs.front())) {
+				// The midpoint is a root.
+				add_root(right.lower);
+				right.coeffs.erase(right.coeffs.begin());
+			}
+			stack.emplace_back(std::move(right));
+			stack.emplace_back(std::move(left));
+		}
+	}
+
 	/// Do actual root isolation.
 	void compute_roots() {
 		// Check for p(0) == 0
@@ -288,12 +444,18 @@ class RealRootIsolation {
 		}
 
 		// Now do actual bisection
-		isolate_by_bisection();
+		if (mStrategy == IsolationStrategy::VCA) {
+			isolate_by_descartes();
+		} else {
+			isolate_by_bisection();
+		}
 	}
 
 public:
-	RealRootIsolation(const UnivariatePolynomial<Number>& polynomial, const Interval<Number>& interval): mPolynomial(carl::squareFreePart(polynomial)), mInterval(interval) {
-		CARL_LOG_DEBUG("carl.core.rootfinder", "Reduced " << polynomial << " to " << mPolynomial);
+	RealRootIsolation(const UnivariatePolynomial<Number>& polynomial, const Interval<Number>& interval, IsolationStrategy strategy = IsolationStrategy::VCA):
+		mPolynomial(carl::squareFreePart(polynomial)), mInterval(interval), mStrategy(strategy)
+	{
+		CARL_LOG_DEBUG("carl.core.rootfinder", "Reduced " << polynomial << " to " << mPolynomial << ", isolating roots using " << mStrategy);
 	}
 
 	/// Compute and sort the roots of mPolynomial within mInterval.
@@ -306,7 +468,7 @@ public:
 				CARL_LOG_DEBUG("carl.core.rootfinder", "Coputing root of factor " << factor);
 				mPolynomial = factor.first;
 				mInterval = interval;
-				// reset_sturm_sequence();
+				reset_sturm_sequence();
 				compute_roots();
 			}
 		} else {
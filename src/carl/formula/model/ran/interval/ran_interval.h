@@ -15,7 +15,11 @@
 
 #include "../ran_operations.h"
 #include "../ran_operations_number.h"
+#include "DoubleFilter.h"
+#include "DoubleFilterStatistics.h"
 
+#include <cmath>
+#include <limits>
 #include <list>
 
 namespace carl {
@@ -67,6 +71,8 @@ private:
 		Interval<Number> interval;
 		/// Sign of polynomial at interval.lower()
 		Sign lower_sign;
+		/// Enclosure by doubles, computed on demand. It stays valid when the interval is refined.
+		std::optional<ran::interval::double_interval> approximation;
 
 		content(const Interval<Number>& i)
 			: polynomial(std::nullopt), interval(i), lower_sign(Sign::ZERO) {}
@@ -147,6 +153,48 @@ private:
 		}
 	}
 
+	/**
+	 * Computes an enclosure by doubles.
+	 * Starting with an enclosure of the interval, we bisect on doubles as long as the sign of the polynomial can be determined by interval arithmetic.
+	 * Midpoints outside the isolating interval are resolved by comparing them to the interval bounds.
+	 */
+	ran::interval::double_interval compute_approximation() const {
+		using ran::interval::double_interval;
+		if (is_numeric()) return double_interval::enclose(interval_int().lower());
+		auto lower = double_interval::enclose(interval_int().lower());
+		auto upper = double_interval::enclose(interval_int().upper());
+		double_interval res = { lower.lower, upper.upper };
+		auto coeffs = ran::interval::enclose_coefficients(polynomial_int());
+		for (std::size_t i = 0; i < std::numeric_limits<double>::digits + 16; ++i) {
+			double mid = res.lower / 2 + res.upper / 2;
+			if (!std::isfinite(mid) || !(res.lower < mid && mid < res.upper)) break;
+			// Only compare exactly if the enclosures of the bounds do not decide.
+			bool below = mid <= lower.lower;
+			bool above = mid >= upper.upper;
+			if (!below && !above && (mid <= lower.upper || mid >= upper.lower)) {
+				Number pivot = carl::rationalize<Number>(mid);
+				below = pivot <= interval_int().lower();
+				above = pivot >= interval_int().upper();
+			}
+			if (below) {
+				res.lower = mid;
+				continue;
+			}
+			if (above) {
+				res.upper = mid;
+				continue;
+			}
+			auto sign = ran::interval::evaluate(coeffs, double_interval{ mid, mid }).sign();
+			if (!sign) break;
+			if (*sign == m_content->lower_sign) {
+				res.lower = mid;
+			} else {
+				res.upper = mid;
+			}
+		}
+		return res;
+	}
+
 public: // TODO should be private
 	void refine() const {
 		if (is_numeric()) return;
@@ -242,6 +290,14 @@ public:
 		return interval_int().lower();
 	}
 
+	/// Returns an enclosure of this number by doubles, which is cached in the shared content.
+	const ran::interval::double_interval& approximation() const {
+		if (!m_content->approximation) {
+			m_content->approximation = compute_approximation();
+		}
+		return *m_content->approximation;
+	}
+
 	real_algebraic_number_interval<Number> abs() const {
 		assert(!interval_int().contains(constant_zero<Number>::get()) || interval_int().isPointInterval());
 		if (interval_int().isSemiPositive()) {
@@ -276,6 +332,11 @@ public:
 	}
 
 	Sign sgn(const Polynomial& p) const {
+		if (auto res = ran::interval::evaluate(p, approximation()).sign()) {
+			CARL_CALL_STATISTICS(ran::interval::filter_statistics().sgnHits++);
+			return *res;
+		}
+		CARL_CALL_STATISTICS(ran::interval::filter_statistics().sgnMisses++);
 		Polynomial tmp = replaceVariable(p);
 		if (polynomial_int() == tmp) return Sign::ZERO;
 		auto seq = carl::sturm_sequence(polynomial_int(), derivative(polynomial_int()) * tmp);
@@ -382,6 +443,12 @@ bool compare(const real_algebraic_number_interval<Number>& lhs, const real_algeb
 
 	if (carl::set_have_intersection(lhs.interval_int(), rhs.interval_int())) {
 		CARL_LOG_TRACE("carl.ran", "Intervals " << lhs.interval_int() << " and " << rhs.interval_int() << " do intersect");
+		if (auto res = ran::interval::compare(lhs.approximation(), rhs.approximation())) {
+			CARL_LOG_TRACE("carl.ran", "Decided by double filter");
+			CARL_CALL_STATISTICS(ran::interval::filter_statistics().compareHits++);
+			return evaluate(*res, relation);
+		}
+		CARL_CALL_STATISTICS(ran::interval::filter_statistics().compareMisses++);
 		auto intersection = carl::set_intersection(lhs.interval_int(), rhs.interval_int());
 		assert(!intersection.isEmpty());
 		lhs.refine_using(intersection.lower());
@@ -438,6 +505,13 @@ bool compare(const real_algebraic_number_interval<Number>& lhs, const real_algeb
 
 template<typename Number>
 bool compare(const real_algebraic_number_interval<Number>& lhs, const Number& rhs, const Relation relation) {
+	if (!lhs.is_numeric() && lhs.interval_int().contains(rhs)) {
+		if (auto res = ran::interval::compare(lhs.approximation(), ran::interval::double_interval::enclose(rhs))) {
+			CARL_CALL_STATISTICS(ran::interval::filter_statistics().compareHits++);
+			return evaluate(*res, relation);
+		}
+		CARL_CALL_STATISTICS(ran::interval::filter_statistics().compareMisses++);
+	}
 	auto res = lhs.refine_using(rhs);
 	if (res) {
 		return evaluate(*res, relation);
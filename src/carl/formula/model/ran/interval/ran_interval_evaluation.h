@@ -109,6 +109,20 @@ real_algebraic_number_interval<Number> evaluate(MultivariatePolynomial<Number> p
 template<typename Number, typename Poly>
 bool evaluate(const Constraint<Poly>& c, const std::map<Variable, real_algebraic_number_interval<Number>>& m, bool refine_model = true, bool use_root_bounds = true) {
 	CARL_LOG_DEBUG("carl.ran", "Evaluating " << c << " on " << m);
+
+	{
+		std::map<Variable, ran::interval::double_interval> approximations;
+		for (const auto& [var, ran] : m) {
+			if (c.lhs().has(var)) approximations.emplace(var, ran.approximation());
+		}
+		auto res = ran::interval::evaluate(c.lhs(), approximations);
+		if (res && res->sign()) {
+			CARL_LOG_DEBUG("carl.ran", "Result obtained by double filter");
+			CARL_CALL_STATISTICS(ran::interval::filter_statistics().evaluateHits++);
+			return evaluate(*res->sign(), c.relation());
+		}
+		CARL_CALL_STATISTICS(ran::interval::filter_statistics().evaluateMisses++);
+	}
 	
 	if (!use_root_bounds) {
 		CARL_LOG_DEBUG("carl.ran", "Evaluate constraint by evaluating poly");
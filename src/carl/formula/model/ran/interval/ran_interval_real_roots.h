@@ -7,6 +7,7 @@
 #include <carl/core/UnivariatePolynomial.h>
 
 #include "RealRootIsolation.h"
+#include <carl/core/polynomialfunctions/SquareFreeBasis.h>
 
 #include <map>
 
@@ -48,6 +49,67 @@ std::vector<real_algebraic_number_interval<Number>> realRoots(
 	return realRoots(polynomial.convert(std::function<Number(const Coeff&)>([](const Coeff& c){ return c.constantPart(); })), interval);
 }
 
+/**
+ * The real roots of a family of univariate polynomials as computed by batchRealRoots().
+ */
+template<typename Number>
+struct BatchRealRoots {
+	/// All roots of all polynomials, sorted in ascending order and without duplicates.
+	std::vector<real_algebraic_number_interval<Number>> roots;
+	/// For every polynomial, the indices into roots of its roots together with their multiplicities, sorted by the index.
+	std::vector<std::vector<std::pair<std::size_t, std::size_t>>> multiplicities;
+	/// For every polynomial, whether it is zero and thus every number is a root.
+	std::vector<bool> nullified;
+};
+
+/**
+ * Find all real roots of a family of univariate 'polynomials' with numeric coefficients within a given 'interval'.
+ * Instead of isolating the roots of every polynomial on its own, we compute a squarefree basis of the polynomials
+ * and isolate the roots of every basis element once.
+ * As the basis elements are pairwise coprime, their roots are distinct and can simply be merged.
+ * The costs hence depend on the distinct factors of the polynomials instead of their number.
+ */
+template<typename Number>
+BatchRealRoots<Number> batchRealRoots(
+		const std::vector<UnivariatePolynomial<Number>>& polynomials,
+		const Interval<Number>& interval = Interval<Number>::unboundedInterval()
+) {
+	CARL_LOG_DEBUG("carl.core.rootfinder", polynomials << " within " << interval);
+	BatchRealRoots<Number> res;
+	res.multiplicities.resize(polynomials.size());
+	res.nullified.resize(polynomials.size(), false);
+
+	auto sfb = carl::squareFreeBasis(polynomials);
+	// The roots together with the index of the basis element they belong to.
+	std::vector<std::pair<real_algebraic_number_interval<Number>, std::size_t>> roots;
+	for (std::size_t i = 0; i < sfb.basis.size(); ++i) {
+		for (auto& r: RealRootIsolation<Number>(sfb.basis[i], interval).get_roots()) {
+			roots.emplace_back(std::move(r), i);
+		}
+	}
+	std::sort(roots.begin(), roots.end(),
+		[](const auto& lhs, const auto& rhs){ return lhs.first < rhs.first; }
+	);
+	// The indices into res.roots of the roots of every basis element.
+	std::vector<std::vector<std::size_t>> basis_roots(sfb.basis.size());
+	for (auto& r: roots) {
+		basis_roots[r.second].emplace_back(res.roots.size());
+		res.roots.emplace_back(std::move(r.first));
+	}
+
+	for (std::size_t p = 0; p < polynomials.size(); ++p) {
+		res.nullified[p] = carl::isZero(polynomials[p]);
+		for (const auto& [factor, multiplicity]: sfb.factors[p]) {
+			for (std::size_t r: basis_roots[factor]) {
+				res.multiplicities[p].emplace_back(r, multiplicity);
+			}
+		}
+		std::sort(res.multiplicities[p].begin(), res.multiplicities[p].end());
+	}
+	CARL_LOG_DEBUG("carl.core.rootfinder", "-> " << res.roots << " with multiplicities " << res.multiplicities);
+	return res;
+}
+
 ////////////////////////////////////////
 ////////////////////////////////////////
 // realRoots() for multivariate polynomials
@@ -17,6 +17,7 @@
 namespace carl {
     #ifdef RAN_USE_INTERVAL
     using carl::ran::interval::realRoots;
+    using carl::ran::interval::batchRealRoots;
     #endif
 
     #ifdef RAN_USE_THOM
@@ -93,6 +93,14 @@ public:
      * @return 
      */
     SPolPair pop( );
+	/**
+	 * Gets the lcm of the pair which would be returned by the next call to pop.
+	 * @return 
+	 */
+    const Monomial::Arg& topLcm( ) const
+    {
+        return mDatastruct.top( )->getSortedFirstLCM( );
+    }
 	/**
 	 * Eliminate multiples of the given monomial.
      * @param lm
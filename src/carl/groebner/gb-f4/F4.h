@@ -0,0 +1,58 @@
+/**
+ * @file   F4.h
+ * @ingroup gb
+ */
+
+#pragma once
+
+#include "../gb-buchberger/Buchberger.h"
+#include "../../util/BitVector.h"
+
+#include <list>
+#include <vector>
+
+namespace carl
+{
+
+/**
+ * Matrix based variant of the Buchberger algorithm following Faugere's F4.
+ * The critical pairs and the criteria to discard them are the same as for Buchberger.
+ * Instead of reducing one S-polynomial at a time, all pairs of minimal degree are reduced together:
+ * the pairs and all reducers needed for them are collected in a sparse matrix (symbolic preprocessing),
+ * which is then brought to row echelon form.
+ * Rows whose leading monomial did not occur as a leading monomial before are added to the basis.
+ * @ingroup gb
+ */
+template<typename Polynomial, template<typename> class AddingPolicy>
+class F4 : public Buchberger<Polynomial, AddingPolicy>
+{
+	using Base = Buchberger<Polynomial, AddingPolicy>;
+	using Coeff = typename Polynomial::CoeffType;
+	using Ordering = typename Polynomial::OrderedBy;
+
+	/// A row of the matrix as pairs of column and coefficient, sorted by column.
+	struct Row {
+		std::vector<std::pair<std::size_t, Coeff>> entries;
+		BitVector reasons;
+	};
+public:
+	F4() = default;
+	F4(const F4& rhs) = default;
+	~F4() override = default;
+
+	void calculate(const std::list<Polynomial>& scheduledForAdding);
+protected:
+	/**
+	 * Removes all critical pairs whose lcm has the minimal total degree.
+	 */
+	std::vector<SPolPair> selectPairs();
+	/**
+	 * Reduces the given pairs and adds the new polynomials to the basis.
+	 * @return true if the basis became constant.
+	 */
+	bool reducePairs(const std::vector<SPolPair>& pairs);
+};
+
+}
+
+#include "F4.tpp"
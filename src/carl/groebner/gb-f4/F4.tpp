@@ -0,0 +1,250 @@
+/**
+ * @file F4.tpp
+ * @ingroup gb
+ */
+#pragma once
+#include "F4.h"
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace carl
+{
+
+/**
+ * Calculate the Groebner basis
+ */
+template<class Polynomial, template<typename> class AddingPolicy>
+void F4<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>& scheduledForAdding)
+{
+	CARL_LOG_INFO("carl.gb.f4", "Calculate gb");
+	for(std::size_t i = 0; i < this->pGb->getGenerators().size(); ++i)
+	{
+		this->mGbElementsIndices.push_back(i);
+	}
+
+	bool foundGB = false;
+	for(const Polynomial& newPol : scheduledForAdding)
+	{
+		if(this->addToGb(newPol))
+		{
+			CARL_LOG_INFO("carl.gb.f4", "Added a constant polynomial.");
+			foundGB = true;
+			break;
+		}
+	}
+
+	while(!foundGB && !this->pCritPairs->empty())
+	{
+		foundGB = reducePairs(selectPairs());
+	}
+	this->mGbElementsIndices.clear();
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+std::vector<SPolPair> F4<Polynomial, AddingPolicy>::selectPairs()
+{
+	std::vector<SPolPair> pairs;
+	uint degree = this->pCritPairs->topLcm()->tdeg();
+	while(!this->pCritPairs->empty() && this->pCritPairs->topLcm()->tdeg() == degree)
+	{
+		pairs.push_back(this->pCritPairs->pop());
+	}
+	CARL_LOG_DEBUG("carl.gb.f4", "Selected " << pairs.size() << " pairs of degree " << degree);
+	return pairs;
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+bool F4<Polynomial, AddingPolicy>::reducePairs(const std::vector<SPolPair>& pairs)
+{
+	const std::vector<Polynomial>& generators = this->pGb->getGenerators();
+	auto multiply = [](const Monomial::Arg& lhs, const Monomial::Arg& rhs) -> Monomial::Arg {
+		if (!lhs) return rhs;
+		if (!rhs) return lhs;
+		return lhs * rhs;
+	};
+
+	// Symbolic preprocessing: collect the rows as (multiplier, generator) and all monomials occurring in them.
+	std::vector<std::pair<Monomial::Arg, std::size_t>> rowSources;
+	std::set<std::pair<Monomial::Arg, std::size_t>> knownRows;
+	std::unordered_set<Monomial::Arg> monomials;
+	std::unordered_set<Monomial::Arg> covered;
+	std::vector<Monomial::Arg> todo;
+	auto addRow = [&](const Monomial::Arg& multiplier, std::size_t index) {
+		if (!knownRows.emplace(multiplier, index).second) return;
+		rowSources.emplace_back(multiplier, index);
+		for (const auto& t: generators[index]) {
+			Monomial::Arg m = multiply(t.monomial(), multiplier);
+			if (monomials.insert(m).second) todo.push_back(m);
+		}
+	};
+	for (const SPolPair& pair: pairs)
+	{
+		covered.insert(pair.mLcm);
+		for (std::size_t index: {pair.mP1, pair.mP2}) {
+			Monomial::Arg multiplier;
+			bool divisible = pair.mLcm->divide(generators[index].lmon(), multiplier);
+			assert(divisible);
+			(void)divisible;
+			addRow(multiplier, index);
+		}
+	}
+	while (!todo.empty())
+	{
+		Monomial::Arg m = todo.back();
+		todo.pop_back();
+		if (!m || covered.count(m) > 0) continue;
+		// Look for the reducer with the fewest terms.
+		std::size_t best = generators.size();
+		Monomial::Arg bestMultiplier;
+		for (std::size_t index: this->mGbElementsIndices)
+		{
+			if (best < generators.size() && generators[index].nrTerms() >= generators[best].nrTerms()) continue;
+			Monomial::Arg multiplier;
+			if (m->divide(generators[index].lmon(), multiplier))
+			{
+				best = index;
+				bestMultiplier = multiplier;
+			}
+		}
+		if (best < generators.size())
+		{
+			covered.insert(m);
+			addRow(bestMultiplier, best);
+		}
+	}
+
+	// Columns are ordered descending with respect to the monomial ordering.
+	std::vector<Monomial::Arg> columns(monomials.begin(), monomials.end());
+	std::sort(columns.begin(), columns.end(), [](const Monomial::Arg& lhs, const Monomial::Arg& rhs){ return Ordering::less(rhs, lhs); });
+	std::unordered_map<Monomial::Arg, std::size_t> columnIndex;
+	for (std::size_t i = 0; i < columns.size(); ++i)
+	{
+		columnIndex.emplace(columns[i], i);
+	}
+
+	std::vector<Row> rows;
+	rows.reserve(rowSources.size());
+	for (const auto& source: rowSources)
+	{
+		Row row;
+		for (const auto& t: generators[source.second])
+		{
+			row.entries.emplace_back(columnIndex[multiply(t.monomial(), source.first)], t.coeff());
+		}
+		std::sort(row.entries.begin(), row.entries.end(), [](const auto& lhs, const auto& rhs){ return lhs.first < rhs.first; });
+		if (Polynomial::Policy::has_reasons)
+		{
+			row.reasons = generators[source.second].getReasons();
+		}
+		rows.push_back(std::move(row));
+	}
+	std::sort(rows.begin(), rows.end(), [](const Row& lhs, const Row& rhs){
+		if (lhs.entries.front().first != rhs.entries.front().first) return lhs.entries.front().first < rhs.entries.front().first;
+		return lhs.entries.size() < rhs.entries.size();
+	});
+	CARL_LOG_DEBUG("carl.gb.f4", "Matrix has " << rows.size() << " rows and " << columns.size() << " columns");
+
+	// Pivot rows are normalized, pivotOf maps columns to their pivot row.
+	std::vector<Row> pivots;
+	std::vector<std::size_t> pivotOf(columns.size(), columns.size());
+	std::vector<Coeff> dense(columns.size(), constant_zero<Coeff>::get());
+	// Reduces the row by all other pivots and normalizes it. Returns false if it becomes zero.
+	auto reduceRow = [&](Row& row) {
+		for (const auto& e: row.entries) dense[e.first] = e.second;
+		std::size_t lead = columns.size();
+		for (std::size_t c = row.entries.front().first; c < columns.size(); ++c)
+		{
+			if (isZero(dense[c])) continue;
+			if (pivotOf[c] == columns.size() || &pivots[pivotOf[c]] == &row)
+			{
+				if (lead == columns.size()) lead = c;
+				continue;
+			}
+			const Row& pivot = pivots[pivotOf[c]];
+			Coeff factor = dense[c];
+			for (const auto& e: pivot.entries)
+			{
+				dense[e.first] -= factor * e.second;
+			}
+			if (Polynomial::Policy::has_reasons)
+			{
+				row.reasons.calculateUnion(pivot.reasons);
+			}
+		}
+		row.entries.clear();
+		if (lead == columns.size()) return false;
+		// Multiplying by the inverse saves a division per entry over finite fields.
+		Coeff inverse = constant_one<Coeff>::get() / dense[lead];
+		for (std::size_t c = lead; c < columns.size(); ++c)
+		{
+			if (isZero(dense[c])) continue;
+			row.entries.emplace_back(c, dense[c] * inverse);
+			dense[c] = constant_zero<Coeff>::get();
+		}
+		return true;
+	};
+	auto normalize = [](Row& row) {
+		Coeff inverse = constant_one<Coeff>::get() / row.entries.front().second;
+		for (auto& e: row.entries) e.second *= inverse;
+	};
+
+	// The shortest row for every leading column is a known pivot, all other rows are reduced by them.
+	std::vector<Row> toReduce;
+	for (Row& row: rows)
+	{
+		if (pivotOf[row.entries.front().first] == columns.size())
+		{
+			normalize(row);
+			pivotOf[row.entries.front().first] = pivots.size();
+			pivots.push_back(std::move(row));
+		}
+		else
+		{
+			toReduce.push_back(std::move(row));
+		}
+	}
+	pivots.reserve(pivots.size() + toReduce.size());
+	// Rows that do not reduce to zero have a new leading monomial.
+	std::vector<std::size_t> newRows;
+	for (Row& row: toReduce)
+	{
+		if (!reduceRow(row)) continue;
+		pivotOf[row.entries.front().first] = pivots.size();
+		newRows.push_back(pivots.size());
+		pivots.push_back(std::move(row));
+	}
+	// Interreduce the new rows, starting with the smallest leading monomial, to obtain a reduced row echelon form.
+	std::sort(newRows.begin(), newRows.end(), [&pivots](std::size_t lhs, std::size_t rhs){
+		return pivots[lhs].entries.front().first > pivots[rhs].entries.front().first;
+	});
+	for (std::size_t index: newRows)
+	{
+		reduceRow(pivots[index]);
+	}
+	CARL_LOG_DEBUG("carl.gb.f4", "Found " << newRows.size() << " new polynomials");
+
+	// Add the new polynomials, starting with the smallest leading monomial.
+	for (std::size_t index: newRows)
+	{
+		const Row& row = pivots[index];
+		typename Polynomial::TermsType terms;
+		terms.reserve(row.entries.size());
+		for (auto e = row.entries.rbegin(); e != row.entries.rend(); ++e)
+		{
+			terms.emplace_back(e->second, columns[e->first]);
+		}
+		Polynomial p(std::move(terms), false, true);
+		if (Polynomial::Policy::has_reasons)
+		{
+			p.setReasons(row.reasons);
+		}
+		if (this->addToGb(p)) return true;
+	}
+	return false;
+}
+
+}
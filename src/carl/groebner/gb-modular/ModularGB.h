@@ -0,0 +1,124 @@
+/**
+ * @file   ModularGB.h
+ * @ingroup gb
+ */
+
+#pragma once
+
+#include "../GBProcedure.h"
+#include "../gb-f4/F4.h"
+#include "../../numbers/GFNumber.h"
+
+#include <list>
+#include <map>
+#include <optional>
+#include <vector>
+
+namespace carl
+{
+
+/**
+ * Modular computation of Groebner bases over the rationals.
+ * The input is scaled to integer coefficients and the reduced Groebner basis is computed over several prime fields using F4.
+ * The primes are smaller than 2^31, such that the coefficients of these images are native integers.
+ * The bases are combined by the chinese remainder theorem and the rational coefficients are obtained by rational reconstruction.
+ * A reconstructed candidate is only verified once it agrees with the image modulo a prime that was not used to reconstruct it,
+ * which cheaply filters out almost all wrong candidates.
+ * The verification is exact and runs over the rationals: all input polynomials reduce to zero modulo the candidate,
+ * and all S-polynomials of the candidate (except those discarded by Buchberger's product criterion) reduce to zero.
+ * Hence an accepted candidate is a Groebner basis of an ideal containing the input.
+ * If the verification fails, further primes are used.
+ *
+ * If the coefficients are not rational, if reasons are tracked, or if no candidate is accepted within maxPrimes primes,
+ * the basis is computed by F4 over the rationals instead.
+ *
+ * In the GB_Katsura, GB_Cyclic and GB_RandomQuadratic benchmarks, the basis modulo a single prime costs
+ * between 0.02 and 0.3 times the computation over the rationals.
+ * @ingroup gb
+ */
+template<typename Polynomial, template<typename> class AddingPolicy>
+class ModularGB : public F4<Polynomial, AddingPolicy>
+{
+	using Base = F4<Polynomial, AddingPolicy>;
+	using Coeff = typename Polynomial::CoeffType;
+	using Ordering = typename Polynomial::OrderedBy;
+	using Integer = typename IntegralType<Coeff>::type;
+	using ModularNumber = GFNumber<sint>;
+	using ModularPolynomial = MultivariatePolynomial<ModularNumber, Ordering>;
+	/// A basis modulo a prime, each polynomial maps its monomials to coefficients in [0, prime).
+	using Image = std::vector<std::map<Monomial::Arg, sint, Ordering>>;
+
+	/// Images obtained from primes that agree on the leading monomials.
+	struct Group {
+		std::vector<Monomial::Arg> leadingMonomials;
+		/// The combined images, each polynomial maps its monomials to coefficients in [0, modulus).
+		std::vector<std::map<Monomial::Arg, Integer, Ordering>> image;
+		Integer modulus = Integer(1);
+		std::size_t primes = 0;
+		/// The last successful reconstruction, empty if the last reconstruction failed.
+		std::vector<Polynomial> reconstruction;
+		/// The coefficients reconstructed so far, they are reused as long as they agree with the image.
+		std::vector<std::map<Monomial::Arg, Coeff, Ordering>> rationals;
+		/// Polynomial and monomial of the coefficient that could not be reconstructed last time.
+		std::optional<std::pair<std::size_t, Monomial::Arg>> failed;
+	};
+public:
+	/**
+	 * Number of primes after which the computation falls back to F4 over the rationals.
+	 * The primes reconstruct numerators and denominators of about 15 bits per prime, hence up to about 950 bits.
+	 */
+	static constexpr std::size_t maxPrimes = 64;
+	/// The primes are chosen larger than this bound and smaller than 2^31.
+	static constexpr unsigned primeBound = 1u << 30;
+
+	ModularGB() = default;
+	ModularGB(const ModularGB& rhs) = default;
+	~ModularGB() override = default;
+
+	void calculate(const std::list<Polynomial>& scheduledForAdding);
+protected:
+	/**
+	 * Computes the reduced Groebner basis of the given integral polynomials modulo prime.
+	 */
+	static Image basisModulo(const std::vector<Polynomial>& input, unsigned prime);
+	/**
+	 * Combines the image modulo the group modulus with the image modulo prime.
+	 */
+	static void combine(Group& group, const Image& image, unsigned prime);
+	/**
+	 * Reconstructs the rational coefficients from the image in the group and stores them as its reconstruction.
+	 * Coefficients that were reconstructed before and still agree with the image are not reconstructed again.
+	 * The coefficient that failed last time is reconstructed first, hence most failing attempts are cheap.
+	 * @return false if some coefficient could not be reconstructed.
+	 */
+	static bool reconstruct(Group& group);
+	/**
+	 * Finds a rational a/b = c mod m with 2*a^2 < m and 2*b^2 < m.
+	 * @return false if there is no such rational.
+	 */
+	static bool reconstruct(const Integer& c, const Integer& m, Coeff& result);
+	/**
+	 * Checks whether the candidate maps to the image modulo prime.
+	 */
+	static bool agrees(const std::vector<Polynomial>& candidate, const Image& image, unsigned prime);
+	/**
+	 * Checks over the rationals that all input polynomials reduce to zero modulo the candidate and that the candidate is a Groebner basis.
+	 */
+	static bool verify(const std::vector<Polynomial>& input, const std::vector<Polynomial>& candidate);
+	/**
+	 * Returns the representative of n modulo prime from [0, prime).
+	 */
+	static sint residue(const Integer& n, unsigned prime);
+	/**
+	 * Returns the first maxPrimes primes larger than primeBound, they are only computed once.
+	 */
+	static const std::vector<unsigned>& primes();
+	/**
+	 * Returns the smallest prime larger than n.
+	 */
+	static unsigned nextPrime(unsigned n);
+};
+
+}
+
+#include "ModularGB.tpp"
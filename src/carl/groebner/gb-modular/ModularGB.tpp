@@ -0,0 +1,338 @@
+/**
+ * @file ModularGB.tpp
+ * @ingroup gb
+ */
+#pragma once
+#include "ModularGB.h"
+#include "../../core/polynomialfunctions/SPolynomial.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+namespace carl
+{
+
+template<class Polynomial, template<typename> class AddingPolicy>
+void ModularGB<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>& scheduledForAdding)
+{
+	if constexpr (!is_rational<Coeff>::value || Polynomial::Policy::has_reasons)
+	{
+		Base::calculate(scheduledForAdding);
+		return;
+	}
+	CARL_LOG_INFO("carl.gb.modular", "Calculate gb");
+	std::vector<Polynomial> input(this->pGb->getGenerators().begin(), this->pGb->getGenerators().end());
+	input.insert(input.end(), scheduledForAdding.begin(), scheduledForAdding.end());
+	input.erase(std::remove_if(input.begin(), input.end(), [](const Polynomial& p){ return isZero(p); }), input.end());
+	if (input.empty()) return;
+
+	// Scale to integer coefficients, the primes must not divide the leading coefficients.
+	std::vector<Polynomial> integral;
+	for (const auto& p: input)
+	{
+		Integer denominator(1);
+		for (const auto& t: p) denominator = carl::lcm(denominator, getDenom(t.coeff()));
+		integral.push_back(p * Coeff(denominator));
+	}
+
+	std::vector<Group> groups;
+	for (std::size_t i = 0; i < maxPrimes; ++i)
+	{
+		unsigned prime = primes()[i];
+		bool permissible = std::all_of(integral.begin(), integral.end(), [prime](const Polynomial& p){
+			return residue(getNum(p.lcoeff()), prime) != 0;
+		});
+		if (!permissible) continue;
+
+		Image image = basisModulo(integral, prime);
+		std::vector<Monomial::Arg> leads;
+		for (const auto& p: image) leads.push_back(p.rbegin()->first);
+		auto group = std::find_if(groups.begin(), groups.end(), [&leads](const Group& g){ return g.leadingMonomials == leads; });
+		if (group == groups.end())
+		{
+			groups.emplace_back();
+			group = groups.end() - 1;
+			group->leadingMonomials = leads;
+		}
+		// The last reconstruction did not use this prime, hence the image is an independent check.
+		bool agreeing = !group->reconstruction.empty() && agrees(group->reconstruction, image, prime);
+		combine(*group, image, prime);
+		CARL_LOG_DEBUG("carl.gb.modular", "Prime " << prime << " gives " << leads.size() << " polynomials, " << group->primes << " primes agree");
+		// Unlucky primes are rare, hence we only consider the group supported by the most primes.
+		if (group->primes < std::max_element(groups.begin(), groups.end(), [](const Group& a, const Group& b){ return a.primes < b.primes; })->primes) continue;
+
+		if (agreeing)
+		{
+			if (verify(input, group->reconstruction))
+			{
+				CARL_LOG_INFO("carl.gb.modular", "Found gb after " << i + 1 << " primes");
+				this->pGb->clear();
+				for (const auto& p: group->reconstruction)
+				{
+					this->pGb->addGenerator(p);
+				}
+				return;
+			}
+			CARL_LOG_DEBUG("carl.gb.modular", "Candidate after " << i + 1 << " primes is no gb of the input");
+		}
+		if (!reconstruct(*group)) group->reconstruction.clear();
+	}
+	CARL_LOG_WARN("carl.gb.modular", "No gb found within " << maxPrimes << " primes, falling back to the rationals");
+	Base::calculate(scheduledForAdding);
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+typename ModularGB<Polynomial, AddingPolicy>::Image ModularGB<Polynomial, AddingPolicy>::basisModulo(const std::vector<Polynomial>& input, unsigned prime)
+{
+	const GaloisField<sint>* gf = GaloisFieldManager<sint>::getInstance().getField(prime);
+	GBProcedure<ModularPolynomial, F4, StdAdding> gb;
+	for (const auto& p: input)
+	{
+		typename ModularPolynomial::TermsType terms;
+		for (const auto& t: p)
+		{
+			ModularNumber c(residue(getNum(t.coeff()), prime), gf);
+			if (!isZero(c)) terms.emplace_back(c, t.monomial());
+		}
+		if (!terms.empty()) gb.addPolynomial(ModularPolynomial(std::move(terms)));
+	}
+	gb.reduceInput();
+	gb.calculate();
+	Image image;
+	for (const auto& p: gb.getBasisPolynomials())
+	{
+		std::map<Monomial::Arg, sint, Ordering> coeffs;
+		for (const auto& t: p)
+		{
+			sint c = t.coeff().representingInteger();
+			coeffs.emplace(t.monomial(), c < 0 ? c + prime : c);
+		}
+		image.push_back(std::move(coeffs));
+	}
+	std::sort(image.begin(), image.end(), [](const auto& lhs, const auto& rhs){
+		return Ordering::less(lhs.rbegin()->first, rhs.rbegin()->first);
+	});
+	return image;
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+void ModularGB<Polynomial, AddingPolicy>::combine(Group& group, const Image& image, unsigned prime)
+{
+	if (group.primes == 0)
+	{
+		for (const auto& coeffs: image)
+		{
+			group.image.emplace_back();
+			for (const auto& c: coeffs) group.image.back().emplace(c.first, fromInt<Integer>(c.second));
+		}
+		group.modulus = Integer(prime);
+		group.primes = 1;
+		return;
+	}
+	const GaloisField<sint>* gf = GaloisFieldManager<sint>::getInstance().getField(prime);
+	ModularNumber inverse = ModularNumber(residue(group.modulus, prime), gf).inverse();
+	assert(group.image.size() == image.size());
+	for (std::size_t i = 0; i < image.size(); ++i)
+	{
+		auto& coeffs = group.image[i];
+		// Monomials missing in one of the images have coefficient zero there.
+		for (const auto& t: image[i]) coeffs.emplace(t.first, Integer(0));
+		for (auto& c: coeffs)
+		{
+			auto it = image[i].find(c.first);
+			sint r = (it == image[i].end()) ? 0 : it->second;
+			// c + modulus * ((r - c) / modulus mod prime)
+			sint factor = ((ModularNumber(r, gf) - ModularNumber(residue(c.second, prime), gf)) * inverse).representingInteger();
+			if (factor < 0) factor += prime;
+			c.second += group.modulus * fromInt<Integer>(factor);
+		}
+	}
+	group.modulus *= Integer(prime);
+	group.primes++;
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+bool ModularGB<Polynomial, AddingPolicy>::reconstruct(Group& group)
+{
+	Coeff c;
+	if (group.failed)
+	{
+		auto it = group.image[group.failed->first].find(group.failed->second);
+		if (!reconstruct(it->second, group.modulus, c)) return false;
+	}
+	group.reconstruction.clear();
+	group.rationals.resize(group.image.size());
+	for (std::size_t i = 0; i < group.image.size(); ++i)
+	{
+		typename Polynomial::TermsType terms;
+		for (const auto& t: group.image[i])
+		{
+			if (isZero(t.second)) continue;
+			auto rational = group.rationals[i].find(t.first);
+			// a/b = c mod m is checked by a single multiplication, the rational reconstruction is far more expensive.
+			if (rational == group.rationals[i].end() || !isZero(carl::mod(Integer(getNum(rational->second) - t.second * getDenom(rational->second)), group.modulus)))
+			{
+				if (!reconstruct(t.second, group.modulus, c))
+				{
+					group.failed = std::make_pair(i, t.first);
+					return false;
+				}
+				rational = group.rationals[i].insert_or_assign(t.first, c).first;
+			}
+			terms.emplace_back(rational->second, t.first);
+		}
+		group.reconstruction.emplace_back(std::move(terms), false, true);
+	}
+	group.failed.reset();
+	return true;
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+bool ModularGB<Polynomial, AddingPolicy>::reconstruct(const Integer& c, const Integer& m, Coeff& result)
+{
+	// Extended euclidean algorithm, stopped at the first remainder r1 with 2*r1^2 < m.
+	// The bit sizes decide this condition for all but the last few remainders.
+	std::size_t bits = carl::bitsize(m);
+	auto large = [&m, bits](const Integer& r) {
+		std::size_t b = carl::bitsize(r);
+		if (2 * b >= bits + 1) return true;
+		if (2 * b + 2 <= bits) return false;
+		return 2 * r * r >= m;
+	};
+	Integer r0 = m, r1 = c;
+	Integer t0(0), t1(1);
+	Integer q, r2;
+	while (large(r1))
+	{
+		carl::divide(r0, r1, q, r2);
+		std::swap(r0, r1);
+		std::swap(r1, r2);
+		t0 -= q * t1;
+		std::swap(t0, t1);
+	}
+	if (2 * t1 * t1 >= m || carl::gcd(r1, carl::abs(t1)) != Integer(1)) return false;
+	result = Coeff(r1) / Coeff(t1);
+	return true;
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+bool ModularGB<Polynomial, AddingPolicy>::agrees(const std::vector<Polynomial>& candidate, const Image& image, unsigned prime)
+{
+	const GaloisField<sint>* gf = GaloisFieldManager<sint>::getInstance().getField(prime);
+	assert(candidate.size() == image.size());
+	for (std::size_t i = 0; i < candidate.size(); ++i)
+	{
+		if (candidate[i].nrTerms() != image[i].size()) return false;
+		for (const auto& t: candidate[i])
+		{
+			auto it = image[i].find(t.monomial());
+			if (it == image[i].end()) return false;
+			ModularNumber denominator(residue(getDenom(t.coeff()), prime), gf);
+			if (isZero(denominator)) return false;
+			if (ModularNumber(residue(getNum(t.coeff()), prime), gf) / denominator != ModularNumber(it->second, gf)) return false;
+		}
+	}
+	return true;
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+bool ModularGB<Polynomial, AddingPolicy>::verify(const std::vector<Polynomial>& input, const std::vector<Polynomial>& candidate)
+{
+	Ideal<Polynomial> ideal;
+	for (const auto& p: candidate) ideal.addGenerator(p);
+	for (const auto& p: input)
+	{
+		Reductor<Polynomial, Polynomial> reductor(ideal, p);
+		if (!isZero(reductor.fullReduce())) return false;
+	}
+	// A constant divides everything, hence all S-polynomials reduce to zero.
+	if (std::any_of(candidate.begin(), candidate.end(), [](const Polynomial& p){ return p.isConstant(); })) return true;
+	std::vector<std::vector<Monomial::Arg>> lcms(candidate.size(), std::vector<Monomial::Arg>(candidate.size()));
+	for (std::size_t i = 0; i < candidate.size(); ++i)
+	{
+		for (std::size_t j = 0; j < candidate.size(); ++j)
+		{
+			lcms[i][j] = Monomial::lcm(candidate[i].lmon(), candidate[j].lmon());
+		}
+	}
+	for (std::size_t i = 0; i < candidate.size(); ++i)
+	{
+		for (std::size_t j = i + 1; j < candidate.size(); ++j)
+		{
+			const auto& lcm = lcms[i][j];
+			// Product criterion: S-polynomials of coprime leading monomials always reduce to zero.
+			if (lcm->tdeg() == candidate[i].lmon()->tdeg() + candidate[j].lmon()->tdeg()) continue;
+			// Chain criterion: the pair is not needed if some lm(k) divides the lcm and both lcm(i,k) and lcm(j,k) are proper divisors of it.
+			bool chain = false;
+			for (std::size_t k = 0; k < candidate.size() && !chain; ++k)
+			{
+				if (k == i || k == j) continue;
+				chain = lcm->divisible(candidate[k].lmon()) && lcms[i][k] != lcm && lcms[j][k] != lcm;
+			}
+			if (chain) continue;
+			Reductor<Polynomial, Polynomial> reductor(ideal, carl::SPolynomial(candidate[i], candidate[j]));
+			if (!isZero(reductor.fullReduce())) return false;
+		}
+	}
+	return true;
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+sint ModularGB<Polynomial, AddingPolicy>::residue(const Integer& n, unsigned prime)
+{
+	sint res = toInt<sint>(Integer(carl::mod(n, Integer(prime))));
+	if (res < 0) res += prime;
+	return res;
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+const std::vector<unsigned>& ModularGB<Polynomial, AddingPolicy>::primes()
+{
+	static const std::vector<unsigned> res = [](){
+		std::vector<unsigned> primes;
+		unsigned prime = primeBound;
+		while (primes.size() < maxPrimes)
+		{
+			prime = nextPrime(prime);
+			primes.push_back(prime);
+		}
+		return primes;
+	}();
+	return res;
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+unsigned ModularGB<Polynomial, AddingPolicy>::nextPrime(unsigned n)
+{
+	// Miller-Rabin test, the bases 2, 7 and 61 suffice for all odd numbers below 2^32.
+	auto isPrime = [](unsigned candidate) {
+		std::uint64_t d = candidate - 1;
+		unsigned s = 0;
+		for (; d % 2 == 0; d /= 2) ++s;
+		for (std::uint64_t base: {2, 7, 61})
+		{
+			if (base % candidate == 0) continue;
+			std::uint64_t x = 1;
+			for (std::uint64_t b = base, e = d; e > 0; e /= 2, b = b * b % candidate)
+			{
+				if (e % 2 == 1) x = x * b % candidate;
+			}
+			if (x == 1 || x == candidate - 1) continue;
+			bool composite = true;
+			for (unsigned r = 1; composite && r < s; ++r)
+			{
+				x = x * x % candidate;
+				if (x == candidate - 1) composite = false;
+			}
+			if (composite) return false;
+		}
+		return true;
+	};
+	for (unsigned candidate = n + 1 + (n % 2); ; candidate += 2)
+	{
+		if (isPrime(candidate)) return candidate;
+	}
+}
+
+}
@@ -0,0 +1,344 @@
+/**
+ * @file IntervalProgram.h
+ */
+
+#pragma once
+
+#include "Interval.h"
+#include "power.h"
+#include "set_theory.h"
+
+#include "../core/MultivariateHorner.h"
+#include "../core/MultivariatePolynomial.h"
+#include "../core/Variable.h"
+
+#include <cassert>
+#include <cstdint>
+#include <map>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace carl {
+
+/**
+ * A set of polynomials that is compiled into a flat program for repeated interval evaluation and contraction.
+ *
+ * Every variable is assigned a slot and a box is a vector of intervals indexed by these slots.
+ * The program is a list of nodes, each of which computes one interval from earlier nodes.
+ * Variables, powers of variables and monomials are shared between all terms and all polynomials of the program,
+ * hence every subexpression is evaluated only once and no map lookups are needed.
+ *
+ * Besides forward evaluation, the program implements the backward projection of HC4:
+ * the value of a polynomial is intersected with a given interval and then propagated back to the variables,
+ * narrowing every node by the inverse of its operation.
+ * The node values are stored within the program, so neither operation allocates memory for floating point intervals,
+ * but a program can not be used from multiple threads at once.
+ * Roots are only available for floating point intervals, other number types do not project through powers.
+ */
+template<typename Number = double>
+class IntervalProgram {
+public:
+	/// Intervals for all variables, indexed by their slots.
+	using Box = std::vector<Interval<Number>>;
+private:
+	enum class Op: std::uint8_t {
+		/// v = box[a]
+		Var,
+		/// v = constant[a]
+		Const,
+		/// v = v[a] + v[b]
+		Add,
+		/// v = v[a] * v[b]
+		Mul,
+		/// v = v[a] * constant[b]
+		Scale,
+		/// v = v[a] ^ b
+		Pow
+	};
+	struct Node {
+		Op op;
+		std::uint32_t a;
+		std::uint32_t b;
+	};
+	/// The nodes a polynomial depends on, in the order of the program.
+	struct Output {
+		std::uint32_t root;
+		std::vector<std::uint32_t> nodes;
+		std::vector<std::uint32_t> variables;
+	};
+
+	std::vector<Variable> mVariables;
+	std::vector<Node> mProgram;
+	std::vector<Interval<Number>> mConstants;
+	std::vector<Output> mOutputs;
+	/// The values of the nodes of the last evaluation or contraction.
+	std::vector<Interval<Number>> mValues;
+	/// Whether the value of a node was narrowed during the current contraction.
+	std::vector<bool> mNarrowed;
+
+	/// Caches shared subexpressions during the compilation.
+	std::map<Variable, std::uint32_t> mSlots;
+	std::vector<std::uint32_t> mVariableNodes;
+	std::map<std::pair<std::uint32_t, std::size_t>, std::uint32_t> mPowers;
+	std::map<Monomial::Arg, std::uint32_t> mMonomials;
+
+	std::uint32_t emit(Op op, std::uint32_t a, std::uint32_t b = 0) {
+		mProgram.emplace_back(Node{op, a, b});
+		mValues.emplace_back();
+		mNarrowed.emplace_back(false);
+		return static_cast<std::uint32_t>(mProgram.size() - 1);
+	}
+	template<typename Coeff>
+	std::uint32_t constant(const Coeff& c) {
+		mConstants.emplace_back(c);
+		return static_cast<std::uint32_t>(mConstants.size() - 1);
+	}
+	std::uint32_t variable(Variable v) {
+		auto it = mSlots.find(v);
+		if (it != mSlots.end()) return mVariableNodes[it->second];
+		auto slot = static_cast<std::uint32_t>(mVariables.size());
+		mVariables.emplace_back(v);
+		mSlots.emplace(v, slot);
+		mVariableNodes.emplace_back(emit(Op::Var, slot));
+		return mVariableNodes.back();
+	}
+	std::uint32_t power(Variable v, std::size_t exp) {
+		std::uint32_t var = variable(v);
+		if (exp == 1) return var;
+		auto key = std::make_pair(var, exp);
+		auto it = mPowers.find(key);
+		if (it != mPowers.end()) return it->second;
+		std::uint32_t res = emit(Op::Pow, var, static_cast<std::uint32_t>(exp));
+		mPowers.emplace(key, res);
+		return res;
+	}
+	std::uint32_t monomial(const Monomial::Arg& m) {
+		auto it = mMonomials.find(m);
+		if (it != mMonomials.end()) return it->second;
+		std::uint32_t res = 0;
+		bool first = true;
+		for (const auto& [var, exp]: m->exponents()) {
+			std::uint32_t p = power(var, exp);
+			res = first ? p : emit(Op::Mul, res, p);
+			first = false;
+		}
+		mMonomials.emplace(m, res);
+		return res;
+	}
+	template<typename Coeff>
+	std::uint32_t term(std::uint32_t node, const Coeff& coeff) {
+		if (carl::isOne(coeff)) return node;
+		return emit(Op::Scale, node, constant(coeff));
+	}
+	template<typename C, typename O, typename P>
+	std::uint32_t compile(const MultivariatePolynomial<C,O,P>& p) {
+		if (carl::isZero(p)) return emit(Op::Const, constant(C(0)));
+		std::uint32_t res = 0;
+		bool first = true;
+		for (const auto& t: p) {
+			std::uint32_t node = t.isConstant() ? emit(Op::Const, constant(t.coeff())) : term(monomial(t.monomial()), t.coeff());
+			res = first ? node : emit(Op::Add, res, node);
+			first = false;
+		}
+		return res;
+	}
+	template<typename Pol, typename Strategy>
+	std::uint32_t compile(const MultivariateHorner<Pol,Strategy>& h) {
+		if (h.getVariable() == Variable::NO_VARIABLE) {
+			return emit(Op::Const, constant(h.getIndepConstant()));
+		}
+		std::uint32_t res = power(h.getVariable(), h.getExponent());
+		if (h.getDependent()) {
+			res = emit(Op::Mul, res, compile(*h.getDependent()));
+		} else {
+			res = term(res, h.getDepConstant());
+		}
+		if (h.getIndependent()) {
+			return emit(Op::Add, res, compile(*h.getIndependent()));
+		} else if (!carl::isZero(h.getIndepConstant())) {
+			return emit(Op::Add, res, emit(Op::Const, constant(h.getIndepConstant())));
+		}
+		return res;
+	}
+	/// Collects the nodes the given root depends on.
+	std::size_t add_output(std::uint32_t root) {
+		Output out{root, {}, {}};
+		std::vector<bool> used(mProgram.size(), false);
+		used[root] = true;
+		for (std::size_t i = root + 1; i-- > 0;) {
+			if (!used[i]) continue;
+			const Node& n = mProgram[i];
+			switch (n.op) {
+				case Op::Var: out.variables.emplace_back(static_cast<std::uint32_t>(i)); break;
+				case Op::Const: break;
+				case Op::Add: case Op::Mul: used[n.a] = true; used[n.b] = true; break;
+				case Op::Scale: case Op::Pow: used[n.a] = true; break;
+			}
+		}
+		for (std::size_t i = 0; i <= root; ++i) {
+			if (used[i]) out.nodes.emplace_back(static_cast<std::uint32_t>(i));
+		}
+		mOutputs.emplace_back(std::move(out));
+		return mOutputs.size() - 1;
+	}
+
+	void forward(const Node& n, Interval<Number>& v, const Box& box) const {
+		switch (n.op) {
+			case Op::Var: v = box[n.a]; break;
+			case Op::Const: v = mConstants[n.a]; break;
+			case Op::Add: v = mValues[n.a] + mValues[n.b]; break;
+			case Op::Mul: v = mValues[n.a] * mValues[n.b]; break;
+			case Op::Scale: v = mValues[n.a] * mConstants[n.b]; break;
+			case Op::Pow: v = carl::pow(mValues[n.a], n.b); break;
+		}
+	}
+
+	/// Intersects the value of a node with the given interval, returns false if the result is empty.
+	bool narrow(std::uint32_t node, const Interval<Number>& i) {
+		if (i.contains(mValues[node])) return true;
+		mValues[node] = set_intersection(mValues[node], i);
+		mNarrowed[node] = true;
+		return !mValues[node].isEmpty();
+	}
+	/// Intersects the value of a node with num / den, returns false if the result is empty.
+	bool narrow_quotient(std::uint32_t node, const Interval<Number>& num, const Interval<Number>& den) {
+		Interval<Number> resA;
+		Interval<Number> resB;
+		if (!num.div_ext(den, resA, resB)) {
+			return narrow(node, resA);
+		}
+		resA = set_intersection(mValues[node], resA);
+		resB = set_intersection(mValues[node], resB);
+		if (resA.isEmpty()) return narrow(node, resB);
+		if (resB.isEmpty()) return narrow(node, resA);
+		return narrow(node, resA.convexHull(resB));
+	}
+	/// Intersects the value of a node with the exp'th root of the given interval, returns false if the result is empty.
+	bool narrow_root(std::uint32_t node, const Interval<Number>& i, std::uint32_t exp) {
+		if constexpr (std::is_floating_point<Number>::value) {
+			Interval<Number> root = i.root(static_cast<int>(exp));
+			if (exp % 2 == 1) return narrow(node, root);
+			Interval<Number> pos = set_intersection(mValues[node], root);
+			Interval<Number> neg = set_intersection(mValues[node], -root);
+			if (pos.isEmpty()) return narrow(node, neg);
+			if (neg.isEmpty()) return narrow(node, pos);
+			return narrow(node, pos.convexHull(neg));
+		} else {
+			// Roots are only available for floating point intervals, only check the sign.
+			if (exp % 2 == 0 && !i.isInfinite() && i.upperBoundType() != BoundType::INFTY && i.upper() < carl::constant_zero<Number>().get()) {
+				mValues[node] = Interval<Number>::emptyInterval();
+				return false;
+			}
+			return true;
+		}
+	}
+	/// Propagates the value of a node to its arguments, returns false if some argument becomes empty.
+	bool backward(std::uint32_t node) {
+		// Projecting an unchanged value can not narrow the arguments.
+		if (!mNarrowed[node]) return true;
+		const Node& n = mProgram[node];
+		const Interval<Number>& v = mValues[node];
+		switch (n.op) {
+			case Op::Var: return true;
+			case Op::Const: return true;
+			case Op::Add:
+				return narrow(n.a, v - mValues[n.b]) && narrow(n.b, v - mValues[n.a]);
+			case Op::Mul:
+				return narrow_quotient(n.a, v, mValues[n.b]) && narrow_quotient(n.b, v, mValues[n.a]);
+			case Op::Scale:
+				return narrow_quotient(n.a, v, mConstants[n.b]);
+			case Op::Pow:
+				return narrow_root(n.a, v, n.b);
+		}
+		return true;
+	}
+
+public:
+	/**
+	 * Adds a polynomial to the program.
+	 * @return The index of the polynomial, used for evaluation and contraction.
+	 */
+	template<typename C, typename O, typename P>
+	std::size_t add(const MultivariatePolynomial<C,O,P>& p) {
+		return add_output(compile(p));
+	}
+	/**
+	 * Adds a polynomial in Horner form to the program.
+	 * As variables occur less often in the Horner form, it often yields tighter enclosures.
+	 * @return The index of the polynomial, used for evaluation and contraction.
+	 */
+	template<typename Pol, typename Strategy>
+	std::size_t add(const MultivariateHorner<Pol,Strategy>& h) {
+		return add_output(compile(h));
+	}
+
+	/// The variables in the order of their slots.
+	const std::vector<Variable>& variables() const {
+		return mVariables;
+	}
+	/// The slot of the given variable, which must occur in the program.
+	std::size_t slot(Variable v) const {
+		assert(mSlots.find(v) != mSlots.end());
+		return mSlots.at(v);
+	}
+	/// The number of nodes of the program.
+	std::size_t size() const {
+		return mProgram.size();
+	}
+	/// Creates a box from the intervals of the given map.
+	Box box(const std::map<Variable, Interval<Number>>& map) const {
+		Box res;
+		for (Variable v: mVariables) {
+			assert(map.find(v) != map.end());
+			res.emplace_back(map.at(v));
+		}
+		return res;
+	}
+
+	/**
+	 * Evaluates a polynomial over the given box.
+	 * @param box An interval for every variable of the program.
+	 * @param output The index of the polynomial as returned by add().
+	 */
+	const Interval<Number>& evaluate(const Box& box, std::size_t output) {
+		assert(box.size() == mVariables.size());
+		assert(output < mOutputs.size());
+		for (std::uint32_t i: mOutputs[output].nodes) {
+			forward(mProgram[i], mValues[i], box);
+			mNarrowed[i] = false;
+		}
+		return mValues[mOutputs[output].root];
+	}
+
+	/**
+	 * Contracts the box with respect to the constraint that the value of a polynomial lies in the given interval.
+	 * The polynomial is evaluated over the box, its value is intersected with the given interval
+	 * and then projected back onto the variables. Integer variables are rounded to their integral part.
+	 * @param box An interval for every variable of the program, is narrowed.
+	 * @param output The index of the polynomial as returned by add().
+	 * @param relation The interval the polynomial must lie in, e.g. [0, oo) for p >= 0.
+	 * @return false if the box contains no solution, the box is not modified in this case.
+	 */
+	bool contract(Box& box, std::size_t output, const Interval<Number>& relation) {
+		const Output& out = mOutputs[output];
+		evaluate(box, output);
+		if (!narrow(out.root, relation)) return false;
+		for (auto it = out.nodes.rbegin(); it != out.nodes.rend(); ++it) {
+			if (!backward(*it)) return false;
+		}
+		for (std::uint32_t node: out.variables) {
+			if (!mNarrowed[node]) continue;
+			if (mVariables[mProgram[node].a].type() == VariableType::VT_INT) {
+				mValues[node] = mValues[node].integralPart();
+				if (mValues[node].isEmpty()) return false;
+			}
+		}
+		for (std::uint32_t node: out.variables) {
+			if (mNarrowed[node]) box[mProgram[node].a] = mValues[node];
+		}
+		return true;
+	}
+};
+
+}
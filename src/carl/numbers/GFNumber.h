@@ -47,11 +47,13 @@ class GFNumber
 		return GFNumber(mN, newfield);
 	}
 	
+	/**
+	 * Brings the representing integer into the symmetric range of the field, if the field is known.
+	 */
 	void normalize()
 	{
-		if(isZero() || isUnit()) return;
-		assert(mGf != nullptr);
-		mGf->modulo(mN);
+		if(isZero() || isUnit() || mGf == nullptr) return;
+		mN = mGf->modulo(mN);
 	}
 	
 	bool isZero() const
@@ -201,6 +203,29 @@ inline bool isInteger(const GFNumber<IntegerT>& /*unused*/) {
 	return false;
 }
 
+/**
+ * Creates a galois field number from an integer. The number is not yet associated with a field.
+ */
+template<>
+inline GFNumber<mpz_class> fromInt(const sint& n) {
+	return GFNumber<mpz_class>(fromInt<mpz_class>(n));
+}
+
+template<>
+inline GFNumber<mpz_class> fromInt(const uint& n) {
+	return GFNumber<mpz_class>(fromInt<mpz_class>(n));
+}
+
+template<>
+inline GFNumber<sint> fromInt(const sint& n) {
+	return GFNumber<sint>(n);
+}
+
+template<>
+inline GFNumber<sint> fromInt(const uint& n) {
+	return GFNumber<sint>(static_cast<sint>(n));
+}
+
 /**
  * Creates the string representation to the given galois field number.
  * @param _number The galois field number to get its string representation for.
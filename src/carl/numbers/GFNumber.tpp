@@ -127,6 +127,7 @@ GFNumber<IntegerType>& GFNumber<IntegerType>::operator +=(const GFNumber& rhs)
 		mGf = rhs.mGf;
 	}
 	mN += rhs.mN;
+	normalize();
 	return *this;
 }
 
@@ -134,6 +135,7 @@ template<typename IntegerType>
 GFNumber<IntegerType>& GFNumber<IntegerType>::operator +=(const IntegerType& rhs)
 {
 	mN += rhs;
+	normalize();
 	return *this;
 }
 
@@ -170,6 +172,7 @@ GFNumber<IntegerType>& GFNumber<IntegerType>::operator -=(const GFNumber& rhs)
 		mGf = rhs.mGf;
 	}
 	mN -= rhs.mN;
+	normalize();
 	return *this;
 }
 
@@ -177,6 +180,7 @@ template<typename IntegerType>
 GFNumber<IntegerType>& GFNumber<IntegerType>::operator -=(const IntegerType& rhs)
 {
 	mN -= rhs;
+	normalize();
 	return *this;
 }
 
@@ -201,8 +205,12 @@ GFNumber<IntegerT> operator*(const IntegerT& lhs, const GFNumber<IntegerT>& rhs)
 template<typename IntegerT>
 GFNumber<IntegerT>& GFNumber<IntegerT>::operator *=(const GFNumber& rhs)
 {
-	assert(rhs.mGf == nullptr || *mGf == *(rhs.mGf));
+	assert(mGf == nullptr || rhs.mGf == nullptr || *mGf == *(rhs.mGf));
+	if (mGf == nullptr) {
+		mGf = rhs.mGf;
+	}
 	mN *= rhs.mN;
+	normalize();
 	return *this;
 }
 
@@ -210,6 +218,7 @@ template<typename IntegerType>
 GFNumber<IntegerType>& GFNumber<IntegerType>::operator *=(const IntegerType& rhs)
 {
 	mN *= rhs;
+	normalize();
 	return *this;
 }
 
@@ -218,6 +227,8 @@ template<typename IntegerT>
 GFNumber<IntegerT> operator/(const GFNumber<IntegerT>& lhs, const GFNumber<IntegerT>& rhs)
 {
 	assert(!rhs.isZero());
+	// Units may stem from integers that are not yet associated with a field.
+	if (rhs.isUnit()) return lhs;
 	assert(rhs.mGf != nullptr);
 	return GFNumber<IntegerT>(lhs.mN * rhs.inverse().mN, rhs.mGf);
 }
@@ -227,7 +238,11 @@ template<typename IntegerT>
 GFNumber<IntegerT>& GFNumber<IntegerT>::operator /=(const GFNumber<IntegerT>& rhs)
 {
 	assert(!rhs.isZero());
-	mN * rhs.inverse().mN;
+	if (rhs.isUnit()) return *this;
+	assert(rhs.mGf != nullptr);
+	mGf = rhs.mGf;
+	mN *= rhs.inverse().mN;
+	normalize();
 	return *this;
 }
 
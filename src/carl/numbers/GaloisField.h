@@ -10,9 +10,11 @@
 #include "../numbers/numbers.h"
 #include "../util/Singleton.h"
 
+#include <cassert>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <type_traits>
 #include <utility>
 
 namespace carl
@@ -38,6 +40,8 @@ private:
 	const IntegerType mPK; // = mP ^ mK
 	const IntegerType mMaxValue; // = (mPK-1) / 2
 	const IntegerType mModulus; // = (mPK+1) / 2 = mMaxValue + 1
+	/// Approximation of 1 / mPK, used to reduce native integers.
+	double mInverse = 0;
 	
 	public:
 	/**
@@ -52,6 +56,12 @@ private:
 		mMaxValue((mPK-1)/2),
 		mModulus(mMaxValue+1)
 	{ 
+		if constexpr (std::is_integral<IntegerType>::value) {
+			static_assert(std::is_signed<IntegerType>::value, "Galois fields over native integers use signed representatives.");
+			// Products of two representatives must not overflow.
+			assert(mPK < (IntegerType(1) << 31));
+			mInverse = 1.0 / static_cast<double>(mPK);
+		}
 	}
 	
 	/**
@@ -78,12 +88,38 @@ private:
 		return symmetricModulo(n);
 	}
 	
+	/**
+	 * Returns the representative of n from the symmetric range (-mPK/2, mPK/2].
+	 * The representative is unique, in particular negative numbers are mapped into this range as well.
+	 * For native integers, the remainder is computed by Barrett reduction with a floating point approximation of 1 / mPK.
+	 * The approximate quotient is off by at most one if |n| / mPK < 2^50, which holds for products of representatives.
+	 * Otherwise, the remainder is computed by an integer division.
+	 * @param n Integer.
+	 * @return Representative of n.
+	 */
 	IntegerType symmetricModulo(const IntegerType& n) const	{
-		if (n > mMaxValue) {
-			return carl::mod(IntegerType(n-mModulus), mPK) - mMaxValue;
+		IntegerType res;
+		if constexpr (std::is_integral<IntegerType>::value) {
+			assert(n < (IntegerType(1) << 62) && -n < (IntegerType(1) << 62));
+			res = n - static_cast<IntegerType>(static_cast<double>(n) * mInverse) * mPK;
+			if (res >= mPK) {
+				res -= mPK;
+			} else if (res <= -mPK) {
+				res += mPK;
+			}
+			if (res >= mPK || res <= -mPK) {
+				res = carl::mod(n, mPK);
+			}
 		} else {
-			return carl::mod(n, mPK);
+			// carl::mod truncates, hence the remainder lies in (-mPK, mPK).
+			res = carl::mod(n, mPK);
+		}
+		if (2 * res > mPK) {
+			res -= mPK;
+		} else if (2 * res <= -mPK) {
+			res += mPK;
 		}
+		return res;
 	}
 	
 	friend bool operator==(const GaloisField& lhs, const GaloisField& rhs) {
@@ -0,0 +1,126 @@
+#include "SmallRational.h"
+
+#include <sstream>
+
+namespace carl {
+
+namespace {
+	/// Number of bits of the binary representation, consistent with mpz_sizeinbase(n, 2).
+	std::size_t bits(uint n) {
+		std::size_t res = 1;
+		while (n >>= 1) ++res;
+		return res;
+	}
+	bool fits(const mpz_class& n) {
+		// Excludes the minimal integer, whose absolute value needs 64 bits.
+		return mpz_sizeinbase(n.get_mpz_t(), 2) < 64;
+	}
+}
+
+SmallRational::SmallRational(sint num, sint den) {
+	assert(den != 0);
+	if (num != detail_smallrational::min && den != detail_smallrational::min) {
+		sint g = std::gcd(num, den);
+		if (den < 0) g = -g;
+		mNum = num / g;
+		mDen = den / g;
+		return;
+	}
+	mpq_class res(carl::fromInt<mpz_class>(num), carl::fromInt<mpz_class>(den));
+	res.canonicalize();
+	set(std::move(res));
+}
+
+void SmallRational::set(mpq_class&& n) {
+	if (fits(n.get_num()) && fits(n.get_den())) {
+		mNum = toInt<sint>(n.get_num());
+		mDen = toInt<sint>(n.get_den());
+		mLarge.reset();
+	} else if (mLarge) {
+		*mLarge = std::move(n);
+	} else {
+		mNum = 0;
+		mDen = 1;
+		mLarge = std::make_unique<mpq_class>(std::move(n));
+	}
+}
+
+void SmallRational::combine_large(const SmallRational& rhs, void (*op)(mpq_ptr, mpq_srcptr, mpq_srcptr)) {
+	mpq_class lhs_tmp;
+	mpq_class rhs_tmp;
+	const mpq_class& l = mLarge ? *mLarge : (lhs_tmp = to_mpq());
+	const mpq_class& r = rhs.mLarge ? *rhs.mLarge : (rhs_tmp = rhs.to_mpq());
+	mpq_class res;
+	op(res.get_mpq_t(), l.get_mpq_t(), r.get_mpq_t());
+	set(std::move(res));
+}
+
+int SmallRational::compare_large(const SmallRational& lhs, const SmallRational& rhs) {
+	mpq_class lhs_tmp;
+	mpq_class rhs_tmp;
+	const mpq_class& l = lhs.mLarge ? *lhs.mLarge : (lhs_tmp = lhs.to_mpq());
+	const mpq_class& r = rhs.mLarge ? *rhs.mLarge : (rhs_tmp = rhs.to_mpq());
+	return mpq_cmp(l.get_mpq_t(), r.get_mpq_t());
+}
+
+std::size_t SmallRational::bitsize() const {
+	if (mLarge) return carl::bitsize(*mLarge);
+	return bits(static_cast<uint>(mNum < 0 ? -mNum : mNum)) + bits(static_cast<uint>(mDen));
+}
+
+mpz_class SmallRational::floor() const {
+	if (mLarge) return carl::floor(*mLarge);
+	sint res = mNum / mDen;
+	if (mNum % mDen != 0 && mNum < 0) --res;
+	return carl::fromInt<mpz_class>(res);
+}
+
+mpz_class SmallRational::ceil() const {
+	if (mLarge) return carl::ceil(*mLarge);
+	sint res = mNum / mDen;
+	if (mNum % mDen != 0 && mNum > 0) ++res;
+	return carl::fromInt<mpz_class>(res);
+}
+
+SmallRational gcd(const SmallRational& a, const SmallRational& b) {
+	if (a.is_small() && b.is_small()) {
+		sint aden = toInt<sint>(a.den());
+		sint bden = toInt<sint>(b.den());
+		sint den;
+		sint g = std::gcd(aden, bden);
+		if (!detail_smallrational::mul_overflow(aden / g, bden, den)) {
+			return SmallRational(std::gcd(toInt<sint>(a.num()), toInt<sint>(b.num())), den);
+		}
+	}
+	return SmallRational(carl::gcd(a.to_mpq(), b.to_mpq()));
+}
+
+SmallRational lcm(const SmallRational& a, const SmallRational& b) {
+	return SmallRational(carl::lcm(a.to_mpq(), b.to_mpq()));
+}
+
+std::ostream& operator<<(std::ostream& os, const SmallRational& n) {
+	if (n.mLarge) return os << *n.mLarge;
+	os << n.mNum;
+	if (n.mDen != 1) os << "/" << n.mDen;
+	return os;
+}
+
+template<>
+SmallRational parse<SmallRational>(const std::string& n) {
+	return SmallRational(carl::parse<mpq_class>(n));
+}
+
+template<>
+bool try_parse<SmallRational>(const std::string& n, SmallRational& res) {
+	mpq_class tmp;
+	if (!carl::try_parse<mpq_class>(n, tmp)) return false;
+	res = SmallRational(std::move(tmp));
+	return true;
+}
+
+std::string toString(const SmallRational& n, bool infix) {
+	return carl::toString(n.to_mpq(), infix);
+}
+
+}
@@ -0,0 +1,507 @@
+/**
+ * @file SmallRational.h
+ *
+ * A rational number type that stores small numbers inline and only falls back to mpq_class for large numbers.
+ */
+
+#pragma once
+
+#include "numbers.h"
+#include "../util/hash.h"
+#include "../util/platform.h"
+
+#include <cassert>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace carl {
+
+namespace detail_smallrational {
+	constexpr sint min = std::numeric_limits<sint>::min();
+	constexpr sint max = std::numeric_limits<sint>::max();
+
+	/// Computes res = a + b, returns true if this overflows.
+	inline bool add_overflow(sint a, sint b, sint& res) {
+	#if defined(__GCC) || defined(__CLANG)
+		return __builtin_add_overflow(a, b, &res);
+	#else
+		if ((b > 0 && a > max - b) || (b < 0 && a < min - b)) return true;
+		res = a + b;
+		return false;
+	#endif
+	}
+	/// Computes res = a * b, returns true if this overflows.
+	inline bool mul_overflow(sint a, sint b, sint& res) {
+	#if defined(__GCC) || defined(__CLANG)
+		return __builtin_mul_overflow(a, b, &res);
+	#else
+		if (a > 0) {
+			if (b > 0 ? a > max / b : b < min / a) return true;
+		} else if (a < 0) {
+			if (b > 0 ? a < min / b : b < max / a) return true;
+		}
+		res = a * b;
+		return false;
+	#endif
+	}
+}
+
+/**
+ * A rational number that is either small, storing numerator and denominator as machine integers, or large, owning an mpq_class.
+ *
+ * Most numbers that occur in practice fit into 64 bits, while every operation on mpq_class calls into GMP and usually allocates memory.
+ * Operations on small numbers use overflow checked machine arithmetic and only fall back to mpq_class if an overflow occurs.
+ * Results that fit into machine integers are always stored as small numbers, hence the representation is canonical.
+ * Small numerators exclude the minimal integer, such that negation can not overflow.
+ *
+ * Unlike Numeric, there is no global state and the type can be used from multiple threads.
+ * It provides the interface of a rational number type and can be used as coefficient type of polynomials or as bound type of intervals.
+ */
+class SmallRational {
+	/// The numerator, if the number is small.
+	sint mNum = 0;
+	/// The denominator, if the number is small. It is positive and coprime to the numerator.
+	sint mDen = 1;
+	/// The number if it is large, nullptr otherwise.
+	std::unique_ptr<mpq_class> mLarge;
+
+	/// Sets a small number from a canonical fraction, fails if the numerator is the minimal integer.
+	bool set_small(sint num, sint den) {
+		assert(den > 0);
+		if (num == detail_smallrational::min) return false;
+		mNum = num;
+		mDen = den;
+		mLarge.reset();
+		return true;
+	}
+	/// Sets the number from a canonical fraction, stores it as small number if possible.
+	void set(mpq_class&& n);
+
+	bool add_small(const SmallRational& rhs) {
+		if (mDen == 1 && rhs.mDen == 1) {
+			sint num;
+			return !detail_smallrational::add_overflow(mNum, rhs.mNum, num) && set_small(num, 1);
+		}
+		// a/b + c/d = (a*(d/g) + c*(b/g)) / (b/g * d) for g = gcd(b,d), then cancel gcd(numerator, g).
+		sint g = std::gcd(mDen, rhs.mDen);
+		sint lhs_den = mDen / g;
+		sint rhs_den = rhs.mDen / g;
+		sint a, c, num;
+		if (detail_smallrational::mul_overflow(mNum, rhs_den, a)) return false;
+		if (detail_smallrational::mul_overflow(rhs.mNum, lhs_den, c)) return false;
+		if (detail_smallrational::add_overflow(a, c, num) || num == detail_smallrational::min) return false;
+		sint g2 = std::gcd(num, g);
+		sint den;
+		if (detail_smallrational::mul_overflow(lhs_den, rhs.mDen / g2, den)) return false;
+		return set_small(num / g2, den);
+	}
+	bool sub_small(const SmallRational& rhs) {
+		if (mDen == 1 && rhs.mDen == 1) {
+			sint num;
+			return !detail_smallrational::add_overflow(mNum, -rhs.mNum, num) && set_small(num, 1);
+		}
+		SmallRational neg(-rhs.mNum, rhs.mDen, true);
+		return add_small(neg);
+	}
+	bool mul_small(const SmallRational& rhs) {
+		sint num, den;
+		if (mDen == 1 && rhs.mDen == 1) {
+			return !detail_smallrational::mul_overflow(mNum, rhs.mNum, num) && set_small(num, 1);
+		}
+		if (mNum == 0 || rhs.mNum == 0) return set_small(0, 1);
+		// Cancel before multiplying to keep the intermediate results small.
+		sint g1 = std::gcd(mNum, rhs.mDen);
+		sint g2 = std::gcd(rhs.mNum, mDen);
+		if (detail_smallrational::mul_overflow(mNum / g1, rhs.mNum / g2, num)) return false;
+		if (detail_smallrational::mul_overflow(mDen / g2, rhs.mDen / g1, den)) return false;
+		return set_small(num, den);
+	}
+	bool div_small(const SmallRational& rhs) {
+		assert(rhs.mNum != 0);
+		if (mNum == 0) return true;
+		sint g1 = std::gcd(mNum, rhs.mNum);
+		sint g2 = std::gcd(mDen, rhs.mDen);
+		sint num, den;
+		if (detail_smallrational::mul_overflow(mNum / g1, rhs.mDen / g2, num)) return false;
+		if (detail_smallrational::mul_overflow(mDen / g2, rhs.mNum / g1, den)) return false;
+		if (den < 0) {
+			if (den == detail_smallrational::min || num == detail_smallrational::min) return false;
+			num = -num;
+			den = -den;
+		}
+		return set_small(num, den);
+	}
+
+	/// Combines this number with rhs using a GMP function and stores the result.
+	void combine_large(const SmallRational& rhs, void (*op)(mpq_ptr, mpq_srcptr, mpq_srcptr));
+	/// Compares two numbers, one of which is large, using GMP.
+	static int compare_large(const SmallRational& lhs, const SmallRational& rhs);
+
+	/// Constructs a small number from a canonical fraction.
+	SmallRational(sint num, sint den, bool /*canonical*/): mNum(num), mDen(den) {}
+public:
+	SmallRational() = default;
+	template<typename T, typename std::enable_if<std::is_integral<T>::value, int>::type = 0>
+	SmallRational(T n) { // NOLINT
+		if constexpr (std::is_signed<T>::value) {
+			if (static_cast<sint>(n) != detail_smallrational::min) {
+				mNum = static_cast<sint>(n);
+				return;
+			}
+		} else {
+			if (n <= static_cast<uint>(detail_smallrational::max)) {
+				mNum = static_cast<sint>(n);
+				return;
+			}
+		}
+		set(carl::fromInt<mpq_class>(static_cast<typename std::conditional<std::is_signed<T>::value, sint, uint>::type>(n)));
+	}
+	/**
+	 * Constructs the fraction num / den.
+	 * @param num Numerator.
+	 * @param den Denominator, must not be zero.
+	 */
+	SmallRational(sint num, sint den);
+	/// Parses a fraction like mpq_class, e.g. "-3/4".
+	explicit SmallRational(const std::string& s) {
+		mpq_class n(s);
+		n.canonicalize();
+		set(std::move(n));
+	}
+	SmallRational(const mpz_class& n) { // NOLINT
+		set(mpq_class(n));
+	}
+	SmallRational(const mpq_class& n) { // NOLINT
+		set(mpq_class(n));
+	}
+	SmallRational(mpq_class&& n) { // NOLINT
+		set(std::move(n));
+	}
+	SmallRational(const SmallRational& n): mNum(n.mNum), mDen(n.mDen) {
+		if (n.mLarge) mLarge = std::make_unique<mpq_class>(*n.mLarge);
+	}
+	SmallRational(SmallRational&& n) noexcept = default;
+	~SmallRational() = default;
+
+	SmallRational& operator=(const SmallRational& n) {
+		if (this == &n) return *this;
+		if (n.mLarge) {
+			if (mLarge) *mLarge = *n.mLarge;
+			else mLarge = std::make_unique<mpq_class>(*n.mLarge);
+		} else {
+			mNum = n.mNum;
+			mDen = n.mDen;
+			mLarge.reset();
+		}
+		return *this;
+	}
+	SmallRational& operator=(SmallRational&& n) noexcept = default;
+
+	/// Checks whether the number is stored inline.
+	bool is_small() const {
+		return mLarge == nullptr;
+	}
+	/// Returns the number as mpq_class.
+	mpq_class to_mpq() const {
+		if (mLarge) return *mLarge;
+		return mpq_class(carl::fromInt<mpz_class>(mNum), carl::fromInt<mpz_class>(mDen));
+	}
+
+	int sgn() const {
+		if (mLarge) return mpq_sgn(mLarge->get_mpq_t());
+		return (mNum > 0) - (mNum < 0);
+	}
+	bool is_integer() const {
+		// Large numbers may be integers that do not fit.
+		if (mLarge) return mpz_cmp_ui(mLarge->get_den_mpz_t(), 1) == 0;
+		return mDen == 1;
+	}
+	mpz_class num() const {
+		if (mLarge) return mLarge->get_num();
+		return carl::fromInt<mpz_class>(mNum);
+	}
+	mpz_class den() const {
+		if (mLarge) return mLarge->get_den();
+		return carl::fromInt<mpz_class>(mDen);
+	}
+	double to_double() const {
+		if (mLarge) return mLarge->get_d();
+		if (mDen == 1) return static_cast<double>(mNum);
+		return to_mpq().get_d();
+	}
+	std::size_t bitsize() const;
+	std::size_t hash() const {
+		if (mLarge) return std::hash<mpq_class>()(*mLarge);
+		return carl::hash_all(mNum, mDen);
+	}
+	/// Rounds towards negative infinity.
+	mpz_class floor() const;
+	/// Rounds towards positive infinity.
+	mpz_class ceil() const;
+
+	SmallRational& operator+=(const SmallRational& rhs) {
+		if (mLarge || rhs.mLarge || !add_small(rhs)) combine_large(rhs, &mpq_add);
+		return *this;
+	}
+	SmallRational& operator-=(const SmallRational& rhs) {
+		if (mLarge || rhs.mLarge || !sub_small(rhs)) combine_large(rhs, &mpq_sub);
+		return *this;
+	}
+	SmallRational& operator*=(const SmallRational& rhs) {
+		if (mLarge || rhs.mLarge || !mul_small(rhs)) combine_large(rhs, &mpq_mul);
+		return *this;
+	}
+	SmallRational& operator/=(const SmallRational& rhs) {
+		assert(rhs.sgn() != 0);
+		if (mLarge || rhs.mLarge || !div_small(rhs)) combine_large(rhs, &mpq_div);
+		return *this;
+	}
+	SmallRational operator-() const {
+		if (mLarge) return SmallRational(mpq_class(-*mLarge));
+		return SmallRational(-mNum, mDen, true);
+	}
+	SmallRational& operator++() {
+		return *this += SmallRational(1);
+	}
+	SmallRational& operator--() {
+		return *this -= SmallRational(1);
+	}
+
+	friend SmallRational operator+(const SmallRational& lhs, const SmallRational& rhs) {
+		SmallRational res(lhs);
+		return res += rhs;
+	}
+	friend SmallRational operator-(const SmallRational& lhs, const SmallRational& rhs) {
+		SmallRational res(lhs);
+		return res -= rhs;
+	}
+	friend SmallRational operator*(const SmallRational& lhs, const SmallRational& rhs) {
+		SmallRational res(lhs);
+		return res *= rhs;
+	}
+	friend SmallRational operator/(const SmallRational& lhs, const SmallRational& rhs) {
+		SmallRational res(lhs);
+		return res /= rhs;
+	}
+
+	friend bool operator==(const SmallRational& lhs, const SmallRational& rhs) {
+		if (lhs.mLarge && rhs.mLarge) return *lhs.mLarge == *rhs.mLarge;
+		// As the representation is canonical, small and large numbers are never equal.
+		if (lhs.mLarge || rhs.mLarge) return false;
+		return lhs.mNum == rhs.mNum && lhs.mDen == rhs.mDen;
+	}
+	friend bool operator!=(const SmallRational& lhs, const SmallRational& rhs) {
+		return !(lhs == rhs);
+	}
+	friend bool operator<(const SmallRational& lhs, const SmallRational& rhs) {
+		if (!lhs.mLarge && !rhs.mLarge) {
+			if (lhs.mDen == rhs.mDen) return lhs.mNum < rhs.mNum;
+			sint l, r;
+			if (!detail_smallrational::mul_overflow(lhs.mNum, rhs.mDen, l) && !detail_smallrational::mul_overflow(rhs.mNum, lhs.mDen, r)) {
+				return l < r;
+			}
+		}
+		return compare_large(lhs, rhs) < 0;
+	}
+	friend bool operator>(const SmallRational& lhs, const SmallRational& rhs) {
+		return rhs < lhs;
+	}
+	friend bool operator<=(const SmallRational& lhs, const SmallRational& rhs) {
+		return !(rhs < lhs);
+	}
+	friend bool operator>=(const SmallRational& lhs, const SmallRational& rhs) {
+		return !(lhs < rhs);
+	}
+
+	friend std::ostream& operator<<(std::ostream& os, const SmallRational& n);
+};
+
+TRAIT_TRUE(is_rational, SmallRational, );
+TRAIT_TYPE(IntegralType, SmallRational, mpz_class, );
+
+inline bool isZero(const SmallRational& n) {
+	return n.sgn() == 0;
+}
+inline bool is_zero(const SmallRational& n) {
+	return n.sgn() == 0;
+}
+inline bool isOne(const SmallRational& n) {
+	return n == SmallRational(1);
+}
+inline bool is_one(const SmallRational& n) {
+	return n == SmallRational(1);
+}
+inline bool isPositive(const SmallRational& n) {
+	return n.sgn() > 0;
+}
+inline bool isNegative(const SmallRational& n) {
+	return n.sgn() < 0;
+}
+inline bool isInteger(const SmallRational& n) {
+	return n.is_integer();
+}
+inline mpz_class getNum(const SmallRational& n) {
+	return n.num();
+}
+inline mpz_class getDenom(const SmallRational& n) {
+	return n.den();
+}
+inline std::size_t bitsize(const SmallRational& n) {
+	return n.bitsize();
+}
+inline double toDouble(const SmallRational& n) {
+	return n.to_double();
+}
+
+template<typename Integer>
+inline Integer toInt(const SmallRational& n);
+
+template<>
+inline mpz_class toInt<mpz_class>(const SmallRational& n) {
+	assert(isInteger(n));
+	return n.num();
+}
+template<>
+inline sint toInt<sint>(const SmallRational& n) {
+	return toInt<sint>(toInt<mpz_class>(n));
+}
+template<>
+inline uint toInt<uint>(const SmallRational& n) {
+	return toInt<uint>(toInt<mpz_class>(n));
+}
+
+template<>
+inline SmallRational fromInt(const sint& n) {
+	return SmallRational(n);
+}
+template<>
+inline SmallRational fromInt(const uint& n) {
+	return SmallRational(n);
+}
+
+template<>
+inline SmallRational rationalize<SmallRational>(float n) {
+	return SmallRational(carl::rationalize<mpq_class>(n));
+}
+template<>
+inline SmallRational rationalize<SmallRational>(double n) {
+	return SmallRational(carl::rationalize<mpq_class>(n));
+}
+template<>
+inline SmallRational rationalize<SmallRational>(int n) {
+	return SmallRational(n);
+}
+template<>
+inline SmallRational rationalize<SmallRational>(uint n) {
+	return SmallRational(n);
+}
+template<>
+inline SmallRational rationalize<SmallRational>(sint n) {
+	return SmallRational(n);
+}
+
+template<>
+SmallRational parse<SmallRational>(const std::string& n);
+
+template<>
+bool try_parse<SmallRational>(const std::string& n, SmallRational& res);
+
+template<>
+inline mpq_class convert<SmallRational, mpq_class>(const SmallRational& n) {
+	return n.to_mpq();
+}
+template<>
+inline SmallRational convert<mpq_class, SmallRational>(const mpq_class& n) {
+	return SmallRational(n);
+}
+
+inline SmallRational abs(const SmallRational& n) {
+	return isNegative(n) ? -n : n;
+}
+inline mpz_class floor(const SmallRational& n) {
+	return n.floor();
+}
+inline mpz_class ceil(const SmallRational& n) {
+	return n.ceil();
+}
+inline mpz_class round(const SmallRational& n) {
+	return carl::floor(n + SmallRational(1, 2));
+}
+
+/// Computes the gcd of the numerators divided by the lcm of the denominators, like for mpq_class.
+SmallRational gcd(const SmallRational& a, const SmallRational& b);
+/// Computes the lcm of the numerators divided by the gcd of the denominators, like for mpq_class.
+SmallRational lcm(const SmallRational& a, const SmallRational& b);
+
+inline SmallRational& gcd_assign(SmallRational& a, const SmallRational& b) {
+	a = carl::gcd(a, b);
+	return a;
+}
+
+inline SmallRational quotient(const SmallRational& n, const SmallRational& d) {
+	return n / d;
+}
+inline SmallRational div(const SmallRational& a, const SmallRational& b) {
+	return a / b;
+}
+inline SmallRational& div_assign(SmallRational& a, const SmallRational& b) {
+	return a /= b;
+}
+inline SmallRational reciprocal(const SmallRational& a) {
+	return SmallRational(1) / a;
+}
+
+inline SmallRational log(const SmallRational& n) {
+	return SmallRational(carl::log(n.to_mpq()));
+}
+inline SmallRational log10(const SmallRational& n) {
+	return SmallRational(carl::log10(n.to_mpq()));
+}
+inline SmallRational sin(const SmallRational& n) {
+	return SmallRational(carl::sin(n.to_mpq()));
+}
+inline SmallRational cos(const SmallRational& n) {
+	return SmallRational(carl::cos(n.to_mpq()));
+}
+
+inline bool sqrt_exact(const SmallRational& a, SmallRational& b) {
+	mpq_class res;
+	if (!carl::sqrt_exact(a.to_mpq(), res)) return false;
+	b = SmallRational(std::move(res));
+	return true;
+}
+inline SmallRational sqrt(const SmallRational& a) {
+	return SmallRational(carl::sqrt(a.to_mpq()));
+}
+inline std::pair<SmallRational,SmallRational> sqrt_safe(const SmallRational& a) {
+	auto res = carl::sqrt_safe(a.to_mpq());
+	return std::make_pair(SmallRational(std::move(res.first)), SmallRational(std::move(res.second)));
+}
+inline std::pair<SmallRational,SmallRational> root_safe(const SmallRational& a, uint n) {
+	auto res = carl::root_safe(a.to_mpq(), n);
+	return std::make_pair(SmallRational(std::move(res.first)), SmallRational(std::move(res.second)));
+}
+inline std::pair<SmallRational,SmallRational> sqrt_fast(const SmallRational& a) {
+	auto res = carl::sqrt_fast(a.to_mpq());
+	return std::make_pair(SmallRational(std::move(res.first)), SmallRational(std::move(res.second)));
+}
+
+std::string toString(const SmallRational& n, bool infix = true);
+
+}
+
+namespace std {
+
+template<>
+struct hash<carl::SmallRational> {
+	std::size_t operator()(const carl::SmallRational& n) const {
+		return n.hash();
+	}
+};
+
+}
@@ -171,7 +171,12 @@ inline To fromInt(const From& n);
 template<>
 inline mpz_class fromInt(const uint& n) {
 	mpz_class res;
-	mpz_set_ui(res.get_mpz_t(), n);
+	if constexpr (sizeof(uint) <= sizeof(unsigned long)) {
+		mpz_set_ui(res.get_mpz_t(), n);
+	} else {
+		// unsigned long may only have 32 bits.
+		mpz_import(res.get_mpz_t(), 1, -1, sizeof(n), 0, 0, &n);
+	}
 	return res;
 	//assert(n <= std::numeric_limits<unsigned long>::max());
 	//assert(n >= std::numeric_limits<unsigned long>::min());
@@ -181,7 +186,14 @@ inline mpz_class fromInt(const uint& n) {
 template<>
 inline mpz_class fromInt(const sint& n) {
 	mpz_class res;
-	mpz_set_si(res.get_mpz_t(), n);
+	if constexpr (sizeof(sint) <= sizeof(signed long)) {
+		mpz_set_si(res.get_mpz_t(), n);
+	} else {
+		// signed long may only have 32 bits, the magnitude of the minimum is representable as uint.
+		uint magnitude = n < 0 ? uint(0) - static_cast<uint>(n) : static_cast<uint>(n);
+		mpz_import(res.get_mpz_t(), 1, -1, sizeof(magnitude), 0, 0, &magnitude);
+		if (n < 0) mpz_neg(res.get_mpz_t(), res.get_mpz_t());
+	}
 	return res;
 	//assert(n <= std::numeric_limits<signed long>::max());
 	//assert(n >= std::numeric_limits<signed long>::min());
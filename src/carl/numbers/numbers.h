@@ -63,5 +63,6 @@ namespace carl {
 #include "GaloisField.h"
 #include "GFNumber.h"
 #include "Numeric.h"
+#include "SmallRational.h"
 
 #include "conversion/conversion.h"
@@ -7,9 +7,11 @@
 
 #pragma once 
 
+#include <cstdint>
+#include <iterator>
 #include <list>
-#include <mutex>
 #include <tuple>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
@@ -21,14 +23,107 @@
 namespace carl
 {
 
+/**
+ * Maps monomial ids to local ids within one entry of the TermAdditionManager.
+ * It is a hash table with open addressing whose size only depends on the number of terms that were added since the last clear(), but not on the number of monomials in the MonomialPool.
+ * Entries are never removed, but their value is reset to zero. Hence clear() only touches the slots that were actually used.
+ */
+class TermIDMap {
+public:
+	using IDType = unsigned;
+private:
+	struct Slot {
+		/// Monomial id, zero marks an empty slot as monomial ids start at one.
+		std::size_t key = 0;
+		IDType value = 0;
+	};
+	/// Smallest number of slots.
+	static constexpr std::size_t minSize = 16;
+	std::vector<Slot> mSlots = std::vector<Slot>(minSize);
+	/// 64 minus the binary logarithm of the number of slots.
+	unsigned mShift = 60;
+	/// Indices of all slots that are in use.
+	std::vector<std::size_t> mUsed;
+
+	std::size_t slot(std::size_t key) const {
+		// Fibonacci hashing, the table size is a power of two and the high bits of the product are the best mixed ones.
+		std::size_t pos = static_cast<std::size_t>((static_cast<std::uint64_t>(key) * 11400714819323198485ull) >> mShift);
+		while (mSlots[pos].key != 0 && mSlots[pos].key != key) {
+			pos = (pos + 1) & (mSlots.size() - 1);
+		}
+		return pos;
+	}
+	void resize(std::size_t size) {
+		assert((size & (size - 1)) == 0);
+		mSlots = std::vector<Slot>(size);
+		mShift = 64;
+		for (; size > 1; size /= 2) --mShift;
+	}
+	void rehash(std::size_t size) {
+		std::vector<Slot> old;
+		std::swap(old, mSlots);
+		resize(size);
+		mUsed.clear();
+		for (const auto& s: old) {
+			if (s.key == 0) continue;
+			std::size_t pos = slot(s.key);
+			mSlots[pos] = s;
+			mUsed.push_back(pos);
+		}
+	}
+public:
+	/**
+	 * Makes sure that the given number of monomials can be stored without rehashing.
+	 * The table never shrinks while it holds entries. If it is empty and much larger than needed, it is trimmed,
+	 * such that the thread-local TermAdditionManager does not keep the memory of a single large operation.
+	 */
+	void reserve(std::size_t size) {
+		std::size_t target = minSize;
+		while (target < 2 * size) target *= 2;
+		if (target > mSlots.size()) rehash(target);
+		else if (mUsed.empty() && mSlots.size() >= 8 * target) resize(target);
+	}
+	/**
+	 * Returns the local id for the given monomial id, inserting zero if it is not present yet.
+	 */
+	IDType& operator[](std::size_t key) {
+		assert(key != 0);
+		std::size_t pos = slot(key);
+		if (mSlots[pos].key == 0) {
+			if (2 * (mUsed.size() + 1) > mSlots.size()) {
+				rehash(mSlots.size() * 2);
+				pos = slot(key);
+			}
+			mSlots[pos].key = key;
+			mUsed.push_back(pos);
+		}
+		return mSlots[pos].value;
+	}
+	/**
+	 * Removes all entries.
+	 */
+	void clear() {
+		for (auto pos: mUsed) {
+			mSlots[pos] = Slot();
+		}
+		mUsed.clear();
+	}
+};
+
+/**
+ * Collects terms such that terms with the same monomial are added up.
+ *
+ * Every MultivariatePolynomial type has one thread-local instance (MultivariatePolynomial::termAdditionManager()).
+ * It holds several entries, each of which can be used to construct one polynomial. Entries are obtained using getId() and released by readTerms() or dropTerms().
+ */
 template<typename Polynomial, typename Ordering>
 class TermAdditionManager {
 public:
-	using IDType = unsigned;
+	using IDType = TermIDMap::IDType;
 	using Coeff = typename Polynomial::CoeffType;
 	using TermType = Term<Coeff>;
 	using TermPtr = TermType;
-	using TermIDs = std::vector<IDType>;
+	using TermIDs = TermIDMap;
 	using Terms = std::vector<TermPtr>;
 	/* 0: Maps global IDs to local IDs.
 	 * 1: Actual terms by local IDs.
@@ -41,17 +136,6 @@ public:
 private:
 	std::list<Tuple> mData;
 	TAMId mNextId;
-	mutable std::mutex mMutex;
-    
-    #ifdef THREAD_SAFE
-    #define TAM_LOCK_GUARD std::lock_guard<std::mutex> lock( mMutex );
-    #define TAM_LOCK mMutex.lock();
-    #define TAM_UNLOCK mMutex.unlock();
-    #else
-    #define TAM_LOCK_GUARD
-    #define TAM_LOCK
-    #define TAM_UNLOCK
-    #endif
 	
 	TAMId createNewEntry() {
 		TAMId res = mData.emplace(mData.end());
@@ -74,7 +158,6 @@ public:
     #define SWAP_TERMS
 	
 	TAMId getId(std::size_t expectedSize = 0) {
-		TAM_LOCK_GUARD
 		assert(mNextId != mData.end());
 		while (std::get<2>(*mNextId)) {
 			mNextId++;
@@ -90,9 +173,7 @@ public:
         #ifdef SWAP_TERMS
         //memset(&terms[0], 0, sizeof(TermPtr)*terms.size());
         #endif
-        std::size_t greatestIdPlusOne = MonomialPool::getInstance().largestID() + 1;
-		if( std::get<0>(data).size() < greatestIdPlusOne ) std::get<0>(data).resize(greatestIdPlusOne);
-		//memset(&std::get<0>(data)[0], 0, sizeof(IDType)*std::get<0>(data).size());
+		std::get<0>(data).reserve(expectedSize);
 		std::get<3>(data) = constant_zero<Coeff>::get();
 		std::get<4>(data) = 1;
 		std::get<2>(data) = true;
@@ -102,6 +183,11 @@ public:
 		return result;
 	}
 
+	/**
+	 * Adds a term to the given entry.
+	 * @tparam SizeUnknown If the number of terms may exceed the expected size given to getId().
+	 * @tparam NewMonomials Unused, the index grows with the number of terms anyway.
+	 */
     template<bool SizeUnknown, bool NewMonomials = true>
 	void addTerm(TAMId id, const TermPtr& term) {
 		assert(!isZero(term));
@@ -111,8 +197,7 @@ public:
 		Terms& terms = std::get<1>(data);
 		if (term.monomial()) {
 			std::size_t monId = term.monomial()->id();
-			if (NewMonomials && monId >= termIDs.size()) termIDs.resize(monId + 1);
-            IDType locId = termIDs[monId];
+            IDType& locId = termIDs[monId];
 			if (locId != 0) {
 				if (SizeUnknown && locId >= terms.size()) terms.resize(locId + 1);
 				assert(locId < terms.size());
@@ -120,7 +205,7 @@ public:
 				if (!carl::isZero(t.coeff())) {
 					Coeff coeff = t.coeff() + term.coeff();
 					if (carl::isZero(coeff)) {
-						termIDs[monId] = 0;
+						locId = 0;
 						t = std::move(TermType());
 					} else {
 						t.coeff() = std::move(coeff);
@@ -132,7 +217,7 @@ public:
 				if (SizeUnknown && nextID >= terms.size()) terms.resize(nextID + 1);
 				assert(nextID < terms.size());
 				assert(nextID < std::numeric_limits<IDType>::max());
-				termIDs[monId] = nextID;
+				locId = nextID;
 				terms[nextID] = term;
 				++nextID;
 			}
@@ -154,7 +239,12 @@ public:
 		else return terms[max];
 	}
     
-	void readTerms(TAMId id, Terms& terms) {
+	/**
+	 * Moves the collected terms of the given entry to terms and releases the entry.
+	 * If terms uses the same allocator as the manager, the buffers are swapped instead.
+	 */
+	template<typename TermsContainer>
+	void readTerms(TAMId id, TermsContainer& terms) {
         Tuple& data = *id;
 		assert(std::get<2>(data));
 		Terms& t = std::get<1>(data);
@@ -174,11 +264,16 @@ public:
 					t.pop_back();
 				}
 			} else {
-				if ((*i).monomial()) termIDs[(*i).monomial()->id()] = 0;
                 ++i;
             }
 		}
-		std::swap(t, terms);
+		termIDs.clear();
+		if constexpr (std::is_same<Terms, TermsContainer>::value) {
+			std::swap(t, terms);
+		} else {
+			// Never hand our buffer to a container with a different allocator.
+			terms.assign(std::make_move_iterator(t.begin()), std::make_move_iterator(t.end()));
+		}
 		t.clear();
         #else
         terms.clear();
@@ -191,26 +286,21 @@ public:
         {
 			if (*i)
             {
-                termIDs[(*i)->monomial()->id()] = 0;
                 terms.push_back( *i );
                 *i = nullptr;
             }
 		}
 		t.clear();
+		termIDs.clear();
         #endif
-		TAM_LOCK_GUARD
 		std::get<2>(data) = false;
 	}
 
 	void dropTerms(TAMId id) {
 		Tuple& data = *id;
 		assert(std::get<2>(data));
-		Terms& t = std::get<1>(data);
-        TermIDs& termIDs = std::get<0>(data);
-		for (auto i = t.begin(); i != t.end(); i++) {
-			if ((*i).monomial()) termIDs[(*i).monomial()->id()] = 0;
-		}
-		TAM_LOCK_GUARD
+		std::get<0>(data).clear();
+		std::get<1>(data).clear();
 		std::get<2>(data) = false;
 	}
 };
@@ -9,7 +9,7 @@
 
 using namespace carl;
 const static int MAX_KATSURA = 5;
-const static int MAX_CYCLIC = 3;
+const static int MAX_CYCLIC = 5;
 
 template <typename C, typename O, typename P>
 struct GbBenchmark
@@ -69,6 +69,7 @@ struct ExecuteBenchmarks {
     {
         std::vector<AbstractGBProcedure<Polynomial>*> res;
         res.push_back(new GBProcedure<Polynomial, Buchberger, StdAdding>());
+        res.push_back(new GBProcedure<Polynomial, F4, StdAdding>());
         return res;
     }
 };
@@ -131,6 +131,20 @@ namespace carl {
 		}
         #endif
 	};
+	struct HeapMultiplicationExecutor {
+		template<typename Coeff>
+		CMP<Coeff> operator()(const std::tuple<CMP<Coeff>,CMP<Coeff>>& args) {
+			CMP<Coeff> res(std::get<0>(args));
+			return std::forward<const CMP<Coeff>>(res.multiplyHeap(std::get<1>(args)));
+		}
+	};
+	struct TermAdditionMultiplicationExecutor {
+		template<typename Coeff>
+		CMP<Coeff> operator()(const std::tuple<CMP<Coeff>,CMP<Coeff>>& args) {
+			CMP<Coeff> res(std::get<0>(args));
+			return std::forward<const CMP<Coeff>>(res.multiplyTermAddition(std::get<1>(args)));
+		}
+	};
 	struct DivisionExecutor {
 		template<typename Coeff>
 		CMP<Coeff> operator()(const std::tuple<CMP<Coeff>,CMP<Coeff>>& args) {
@@ -371,7 +385,13 @@ TEST_F(BenchmarkTest, Multiplication)
         #ifdef COMPARE_WITH_Z3
 		bench.compare<ZMP, TupleConverter<ZMP,ZMP>>("Z3");
         #endif
-		file.push(bench.result(), bi.degree);
+		auto result = bench.result();
+		Benchmark<AdditionGenerator<Coeff>, HeapMultiplicationExecutor, CMP<Coeff>> heap(bi, "CArL heap");
+		Benchmark<AdditionGenerator<Coeff>, TermAdditionMultiplicationExecutor, CMP<Coeff>> tam(bi, "CArL TAM");
+		for (const auto& r: {heap.result(), tam.result()}) {
+			result.insert(r.begin(), r.end());
+		}
+		file.push(result, bi.degree);
 	}
 }
 
@@ -55,7 +55,7 @@ public:
 		return bi.variables[uniDist(bi.variables.size())];
 	}
     
-	std::shared_ptr<const carl::Monomial> randomMonomial(std::size_t degree) const {
+	carl::Monomial::Arg randomMonomial(std::size_t degree) const {
 		Monomial::Arg res;
 		for (unsigned d = 1; d < degree; d++) {
             res = res * randomVariable();
@@ -75,7 +75,7 @@ public:
     
 	template<typename C>
 	CMP<C> newMP(std::size_t deg) const {
-		auto& manager = carl::MultivariatePolynomial<C>::mTermAdditionManager;
+		auto& manager = carl::MultivariatePolynomial<C>::termAdditionManager();
 		auto id = manager.getId(deg*deg*deg);
 		C c = C(geomDist<C>());
 		manager.template addTerm<true>(id, Term<C>(c));
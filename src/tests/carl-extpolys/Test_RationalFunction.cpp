@@ -1,5 +1,6 @@
 #include "gtest/gtest.h"
 #include <carl-extpolys/RationalFunction.h>
+#include <carl-extpolys/CompiledRationalFunction.h>
 #include <carl/core/VariablePool.h>
 #include <carl/util/stringparser.h>
 #include <carl-extpolys/FactorizedPolynomial.h>
@@ -365,6 +366,61 @@ TEST(RationalFunction, Evaluation)
     EXPECT_EQ( Rational(6), resrf1 );
 }
 
+TEST(RationalFunction, CompiledEvaluation)
+{
+    StringParser sp;
+    sp.setVariables({"x", "y", "z"});
+    Variable x = sp.variables().at("x");
+    Variable y = sp.variables().at("y");
+    Variable z = sp.variables().at("z");
+    Pol p1 = sp.parseMultivariatePolynomial<Rational>("3*x^3*y + x*y^2 + (-1/2)*x + 7");
+    Pol p2 = sp.parseMultivariatePolynomial<Rational>("x^2 + y^2*z^4 + 1");
+    Pol p3 = sp.parseMultivariatePolynomial<Rational>("x*y + (-1)*z");
+
+    auto pCache = std::make_shared<CachePol>();
+    FPol fp1(p1, pCache);
+    FPol fp2(p2, pCache);
+    FPol fp3(p3, pCache);
+
+    RFunc r1(p1 * p3, p2);
+    RFactFunc rf1(fp1 * fp3 * fp3, fp2 * fp2 * Rational(3));
+    CompiledRationalFunction c1(r1);
+    CompiledRationalFunction cf1(rf1);
+    EXPECT_EQ((std::vector<Variable>{x, y, z}), c1.variables());
+    EXPECT_EQ((std::vector<Variable>{x, y, z}), cf1.variables());
+
+    std::vector<Rational> points;
+    std::vector<double> dpoints;
+    for (int i = 0; i < 200; ++i) {
+        for (Rational v: {Rational(Rational(i % 7 - 3) / 2), Rational(Rational(i % 5 + 1) / 3), Rational(i % 11 - 5)}) {
+            points.emplace_back(v);
+            dpoints.emplace_back(carl::toDouble(v));
+        }
+    }
+    std::vector<Rational> results;
+    std::vector<Rational> fresults;
+    c1.evaluate_batch(points, results);
+    cf1.evaluate_batch(points, fresults, 4);
+    std::vector<double> dresults;
+    c1.evaluate_batch(dpoints, dresults, 2);
+    ASSERT_EQ(200, results.size());
+    ASSERT_EQ(200, fresults.size());
+    ASSERT_EQ(200, dresults.size());
+    for (std::size_t i = 0; i < 200; ++i) {
+        std::map<Variable, Rational> substitutions = {{x, points[3*i]}, {y, points[3*i+1]}, {z, points[3*i+2]}};
+        Rational expected = r1.evaluate(substitutions);
+        EXPECT_EQ(expected, results[i]);
+        EXPECT_EQ(expected, c1.evaluate(substitutions));
+        EXPECT_EQ(rf1.evaluate(substitutions), fresults[i]);
+        EXPECT_NEAR(carl::toDouble(expected), dresults[i], 1e-9 * std::max(1.0, std::abs(carl::toDouble(expected))));
+        EXPECT_DOUBLE_EQ(dresults[i], c1.evaluate(std::vector<double>(dpoints.begin() + 3*i, dpoints.begin() + 3*i + 3)));
+    }
+
+    CompiledRationalFunction constant(RFunc(Rational(5, 2)));
+    EXPECT_TRUE(constant.variables().empty());
+    EXPECT_EQ(Rational(5, 2), constant.evaluate(std::vector<Rational>()));
+}
+
 TEST(RationalFunction, Substitute)
 {
     carl::StringParser parser;
@@ -46,6 +46,35 @@ TEST(ModelEvaluation, Constraint)
 }
 
 
+TEST(ModelEvaluation, SubstituteMany)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	Variable w = freshRealVariable("w");
+	ModelT m;
+	m.assign(x, Rational(2));
+	m.assign(y, RANT(Rational(-1)));
+	m.assign(z, RANT::create_safe(UnivariatePolynomial<Rational>(z, {Rational(-2), Rational(0), Rational(1)}), IntervalT(1, BoundType::STRICT, 2, BoundType::STRICT)));
+	Pol p = Pol(x)*x*y + Pol(x)*z*w + Pol(y)*z*z + Pol(3);
+
+	EXPECT_EQ(Pol(2)*z*w - Pol(z)*z - Pol(1), model::substitute(p, m));
+
+	UnivariatePolynomial<Pol> up = carl::to_univariate_polynomial(p, w);
+	EXPECT_EQ(carl::to_univariate_polynomial(Pol(2)*z*w - Pol(z)*z - Pol(1), w), model::substitute(up, m));
+
+	// The main variable itself is assigned.
+	UnivariatePolynomial<Pol> ux = carl::to_univariate_polynomial(p, x);
+	EXPECT_EQ(carl::to_univariate_polynomial(Pol(2)*z*w - Pol(z)*z - Pol(1), x), model::substitute(ux, m));
+
+	m.assign(w, Rational(1)/2);
+	ConstraintT c(p, carl::Relation::LESS);
+	// 2*2*(-1) + 2*z/2 - z^2 + 3 = z - 3 < 0 for z = sqrt(2)
+	auto res = model::evaluate(c, m);
+	EXPECT_TRUE(res.isBool());
+	EXPECT_TRUE(res.asBool());
+}
+
 TEST(ModelEvaluation, EvaluateMVR)
 {
 	Variable x = freshRealVariable("x");
@@ -14,3 +14,56 @@ TEST(Statistics, Timer)
 	timer.finish(start);
 	ASSERT_EQ(timer.count(), 1);
 }
+
+TEST(Statistics, TimerResolution)
+{
+	carl::statistics::timer timer;
+	// Durations below a millisecond are accumulated exactly.
+	for (std::size_t i = 0; i < 100; ++i) {
+		timer.add(std::chrono::microseconds(7));
+	}
+	EXPECT_EQ(timer.count(), 100);
+	EXPECT_EQ(timer.overall_ns(), 700000);
+	EXPECT_EQ(timer.overall_ms(), 0);
+	EXPECT_EQ(timer.mean_ns(), 7000);
+	timer.add(std::chrono::milliseconds(3));
+	EXPECT_EQ(timer.overall_ms(), 3);
+}
+
+TEST(Statistics, Histogram)
+{
+	carl::statistics::histogram_timer timer;
+	for (std::size_t i = 1; i <= 100; ++i) {
+		timer.add(std::chrono::nanoseconds(i * 10));
+	}
+	const auto& h = timer.histogram();
+	EXPECT_EQ(h.count(), 100);
+	EXPECT_EQ(timer.count(), 100);
+	EXPECT_EQ(h.min_ns(), 10);
+	EXPECT_EQ(h.max_ns(), 1000);
+	// The median 500 lies in [256, 512).
+	EXPECT_EQ(h.percentile_ns(50), 511);
+	EXPECT_EQ(h.percentile_ns(100), 1000);
+	EXPECT_LE(h.percentile_ns(0), h.percentile_ns(50));
+	EXPECT_EQ(timer.mean_ns(), 505);
+}
+
+class TestStatistics: public carl::statistics::Statistics {
+public:
+	carl::statistics::histogram_timer timer;
+	void collect() override {
+		Statistics::addKeyValuePair("timer", timer);
+	}
+};
+
+TEST(Statistics, CollectHistogram)
+{
+	TestStatistics stats;
+	stats.timer.add(std::chrono::nanoseconds(1500));
+	stats.collect();
+	const auto& c = stats.collected();
+	EXPECT_EQ(c.at("timer_count"), "1");
+	EXPECT_EQ(c.at("timer_overall_ns"), "1500");
+	EXPECT_EQ(c.at("timer_p50_ns"), "1500");
+	EXPECT_EQ(c.at("timer_max_ns"), "1500");
+}
@@ -177,6 +177,33 @@ carl::MultivariatePolynomial<mpq_class> randomPoly(const std::initializer_list<c
 	return res;
 }
 
+TEST(CoCoA, AdaptorCache) {
+	using Poly = carl::MultivariatePolynomial<mpq_class>;
+	carl::Variable x = carl::freshRealVariable("x");
+	carl::Variable y = carl::freshRealVariable("y");
+	carl::Variable z = carl::freshRealVariable("z");
+
+	auto& cache = carl::CoCoAAdaptorCache<Poly>::getInstance();
+	cache.clear();
+	Poly p1 = (x * x) - y * y;
+	Poly p2 = (x + y) * (x - mpq_class(2));
+	const auto& c1 = cache.get({p1, p2});
+	EXPECT_EQ(Poly(x + y), c1.gcd(p1, p2));
+	// A subset of the variables reuses the ring.
+	Poly p3 = (x * x) - mpq_class(1);
+	Poly p4 = (x + mpq_class(1)) * (x - mpq_class(2));
+	const auto& c2 = cache.get({p3, p4});
+	EXPECT_EQ(&c1, &c2);
+	EXPECT_EQ(Poly(x + mpq_class(1)), c2.gcd(p3, p4));
+	// New variables extend the ring.
+	Poly p5 = (x * z) - z;
+	const auto& c3 = cache.get({p5});
+	EXPECT_EQ(std::vector<carl::Variable>({x, y, z}), c3.variables());
+	EXPECT_EQ(Poly(x - mpq_class(1)), c3.gcd(p3, p5));
+	EXPECT_EQ(Poly(x + y), carl::gcd(p1, p2));
+	cache.clear();
+}
+
 TEST(CoCoA, Benchmark) {
 	using Poly = carl::MultivariatePolynomial<mpq_class>;
 	carl::Variable x = carl::freshRealVariable("x");
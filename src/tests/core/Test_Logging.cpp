@@ -54,3 +54,45 @@ TEST(LoggingHelper, basename)
 {
 	EXPECT_EQ("abc.de", carl::basename("/foo/bar/abc.de"));
 }
+
+TEST(Logging, ChannelLevels)
+{
+	auto& logger = carl::logging::logger();
+	std::stringstream ss;
+	logger.configure("test_channels", ss);
+	logger.filter("test_channels")("", carl::logging::LogLevel::LVL_OFF)("carl.test", carl::logging::LogLevel::LVL_DEBUG);
+	auto channel = carl::logging::channel_id("carl.test.sub");
+	EXPECT_EQ(channel, carl::logging::channel_id("carl.test.sub"));
+	EXPECT_TRUE(carl::logging::visible(carl::logging::LogLevel::LVL_DEBUG, channel));
+	EXPECT_FALSE(carl::logging::visible(carl::logging::LogLevel::LVL_TRACE, channel));
+	logger.filter("test_channels")("carl.test.sub", carl::logging::LogLevel::LVL_TRACE);
+	EXPECT_TRUE(carl::logging::visible(carl::logging::LogLevel::LVL_TRACE, channel));
+
+	__CARL_LOG_TRACE("carl.test.sub", "visible message");
+	__CARL_LOG_TRACE("carl.test", "invisible message");
+	EXPECT_NE(std::string::npos, ss.str().find("visible message"));
+	EXPECT_EQ(std::string::npos, ss.str().find("invisible message"));
+	logger.filter("test_channels")("carl.test", carl::logging::LogLevel::LVL_OFF)("carl.test.sub", carl::logging::LogLevel::LVL_OFF);
+	EXPECT_FALSE(carl::logging::visible(carl::logging::LogLevel::LVL_FATAL, channel));
+	logger.filter("test_channels")("carl.test.sub", carl::logging::LogLevel::LVL_TRACE);
+	logger.remove("test_channels");
+	EXPECT_FALSE(logger.has("test_channels"));
+	EXPECT_FALSE(carl::logging::visible(carl::logging::LogLevel::LVL_FATAL, channel));
+}
+
+TEST(Logging, AsyncSink)
+{
+	auto& logger = carl::logging::logger();
+	std::stringstream ss;
+	auto sink = std::make_shared<carl::logging::AsyncSink>(std::make_shared<carl::logging::StreamSink>(ss), 4);
+	logger.configure("test_async", sink);
+	logger.filter("test_async")("", carl::logging::LogLevel::LVL_OFF)("carl.test.async", carl::logging::LogLevel::LVL_INFO);
+	for (int i = 0; i < 100; ++i) {
+		__CARL_LOG_INFO("carl.test.async", "message " << i);
+	}
+	sink->flush();
+	EXPECT_NE(std::string::npos, ss.str().find("message 0\n"));
+	EXPECT_NE(std::string::npos, ss.str().find("message 99\n"));
+	logger.remove("test_async");
+	EXPECT_FALSE(logger.has("test_async"));
+}
@@ -263,3 +263,81 @@ TEST(Monomial, CalcLCM)
 	carl::Monomial::Arg m2 = x*x*y;
 	EXPECT_EQ(y, carl::Monomial::calcLcmAndDivideBy(m1, m2));
 }
+
+TEST(Monomial, Packed)
+{
+	std::vector<carl::Variable> vars;
+	for (std::size_t i = 0; i < 4; ++i) {
+		vars.push_back(carl::freshRealVariable("p" + std::to_string(i)));
+	}
+	std::vector<carl::Monomial::Arg> monomials;
+	for (std::size_t i = 1; i < 64; ++i) {
+		// The digits of i in base four are the exponents of the first three variables.
+		carl::Monomial::Content c;
+		for (std::size_t j = 0; j < 3; ++j) {
+			carl::exponent e = (i >> (2 * j)) % 4;
+			if (e > 0) c.emplace_back(vars[j], (i % 13 == 0) ? e * 50 : e);
+		}
+		if (i % 7 == 0) c.emplace_back(vars[3], 1);
+		monomials.push_back(carl::createMonomial(std::move(c)));
+	}
+	// Only the first three variables are packed, such that packed and unpacked monomials are mixed.
+	carl::MonomialPool::getInstance().setPackedVariables({vars[2], vars[0], vars[1]});
+	EXPECT_EQ(std::vector<carl::Variable>({vars[0], vars[1], vars[2]}), carl::MonomialPool::getInstance().packedVariables());
+
+	auto exponents = [&vars](const carl::Monomial::Arg& m) {
+		std::vector<carl::exponent> res;
+		for (auto v: vars) res.push_back(m ? m->exponentOfVariable(v) : 0);
+		return res;
+	};
+	auto expectedLexical = [&exponents](const carl::Monomial::Arg& lhs, const carl::Monomial::Arg& rhs) {
+		// Walks the variables like the pairs in lexicalCompare().
+		auto l = exponents(lhs);
+		auto r = exponents(rhs);
+		auto later = [](const std::vector<carl::exponent>& e, std::size_t i) {
+			return std::any_of(e.begin() + long(i) + 1, e.end(), [](carl::exponent x){ return x > 0; });
+		};
+		for (std::size_t i = 0; i < l.size(); ++i) {
+			if (l[i] == r[i]) continue;
+			if (l[i] > 0 && r[i] > 0) return l[i] > r[i] ? carl::CompareResult::LESS : carl::CompareResult::GREATER;
+			if (l[i] == 0) return later(l, i) ? carl::CompareResult::GREATER : carl::CompareResult::LESS;
+			return later(r, i) ? carl::CompareResult::LESS : carl::CompareResult::GREATER;
+		}
+		return carl::CompareResult::EQUAL;
+	};
+
+	std::size_t packed = 0;
+	for (const auto& m: monomials) {
+		auto e = exponents(m);
+		bool packable = e[3] == 0 && std::all_of(e.begin(), e.end(), [](carl::exponent x){ return x <= carl::Monomial::packed_max_exponent; });
+		EXPECT_EQ(packable, m->isPacked());
+		if (m->isPacked()) ++packed;
+	}
+	EXPECT_GT(packed, 0);
+	EXPECT_LT(packed, monomials.size());
+
+	for (const auto& m1: monomials) {
+		for (const auto& m2: monomials) {
+			auto e1 = exponents(m1);
+			auto e2 = exponents(m2);
+			bool divisible = true;
+			std::vector<carl::exponent> lcm;
+			std::vector<carl::exponent> product;
+			for (std::size_t i = 0; i < vars.size(); ++i) {
+				divisible = divisible && e1[i] >= e2[i];
+				lcm.push_back(std::max(e1[i], e2[i]));
+				product.push_back(e1[i] + e2[i]);
+			}
+			EXPECT_EQ(divisible, m1->divisible(m2));
+			carl::Monomial::Arg quotient;
+			EXPECT_EQ(divisible, m1->divide(m2, quotient));
+			if (divisible) {
+				for (std::size_t i = 0; i < vars.size(); ++i) e1[i] -= e2[i];
+				EXPECT_EQ(e1, exponents(quotient));
+			}
+			EXPECT_EQ(lcm, exponents(carl::Monomial::lcm(m1, m2)));
+			EXPECT_EQ(product, exponents(m1 * m2));
+			EXPECT_EQ(expectedLexical(m1, m2), carl::Monomial::lexicalCompare(*m1, *m2));
+		}
+	}
+}
@@ -2,6 +2,9 @@
 
 #include "carl/core/MonomialPool.h"
 
+#include <set>
+#include <thread>
+
 using namespace carl;
 
 TEST(MonomialPool, singleton)
@@ -13,4 +16,57 @@ TEST(MonomialPool, singleton)
 	
 	auto m = createMonomial(x, 3);
 	EXPECT_EQ(pool2.size(), pool1.size());
-}
\ No newline at end of file
+}
+TEST(MonomialPool, hashconsing)
+{
+	MonomialPool& pool = MonomialPool::getInstance();
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	std::size_t before = pool.size();
+
+	std::vector<Monomial::Arg> monomials;
+	std::set<std::size_t> ids;
+	for (exponent e = 1; e <= 200; ++e) {
+		monomials.emplace_back(pool.create({std::make_pair(x, e), std::make_pair(y, 1)}));
+		ids.insert(monomials.back()->id());
+	}
+	EXPECT_EQ(pool.size(), before + 200u);
+	EXPECT_EQ(ids.size(), 200u);
+	for (exponent e = 1; e <= 200; ++e) {
+		auto m = pool.create({std::make_pair(y, 1), std::make_pair(x, e)});
+		EXPECT_EQ(m, monomials[e - 1]);
+	}
+	monomials.clear();
+	EXPECT_EQ(pool.size(), before);
+}
+
+#ifdef THREAD_SAFE
+TEST(MonomialPool, concurrentIDs)
+{
+	MonomialPool& pool = MonomialPool::getInstance();
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	// The ids of all monomials that are alive at the same time have to be distinct.
+	std::vector<std::vector<Monomial::Arg>> monomials(4);
+	std::vector<std::thread> threads;
+	for (std::size_t t = 0; t < monomials.size(); ++t) {
+		threads.emplace_back([&monomials, &pool, x, y, t]() {
+			for (exponent e = 1; e <= 500; ++e) {
+				monomials[t].emplace_back(pool.create({std::make_pair(x, e), std::make_pair(y, t + 1)}));
+				// Temporary monomials free their ids again.
+				pool.create({std::make_pair(x, e), std::make_pair(y, t + 1000)});
+			}
+		});
+	}
+	for (auto& t: threads) t.join();
+	std::set<std::size_t> ids;
+	for (const auto& ms: monomials) {
+		for (const auto& m: ms) {
+			EXPECT_TRUE(m->id() != 0);
+			EXPECT_TRUE(m->id() <= pool.largestID());
+			ids.insert(m->id());
+		}
+	}
+	EXPECT_EQ(ids.size(), 4u * 500u);
+}
+#endif
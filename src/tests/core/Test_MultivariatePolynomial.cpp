@@ -6,6 +6,7 @@
 #include "carl/core/VariablePool.h"
 #include "carl/interval/Interval.h"
 #include <list>
+#include <thread>
 #include "carl/converter/OldGinacConverter.h"
 #include "carl/util/stringparser.h"
 #include "carl/util/platform.h"
@@ -443,6 +444,52 @@ TEST(MultivariatePolynomial, Substitute)
 //    Pol wt = Pol(Rat(0));
 //}
 
+TEST(MultivariatePolynomial, SubstituteMany)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	using Pol = MultivariatePolynomial<Rational>;
+	Pol p = Rational(3) * x*x*x*y + Rational(2) * x*y*z*z - Rational(5) * y*y*z + x*z + Pol(Rational(7));
+	std::vector<std::map<Variable, Rational>> substitutions = {
+		{},
+		{{x, Rational(2)}},
+		{{x, Rational(1)/3}, {z, Rational(-2)}},
+		{{y, Rational(0)}},
+		{{x, Rational(-1)}, {y, Rational(4)/5}, {z, Rational(3)}},
+	};
+	for (const auto& s: substitutions) {
+		Pol expected = p;
+		for (const auto& [var, value]: s) {
+			carl::substitute_inplace(expected, var, Pol(value));
+		}
+		Pol res = p;
+		carl::substitute_inplace(res, s);
+		EXPECT_EQ(expected, res) << "Substitution " << s;
+	}
+	// Terms that coincide after the substitution are merged.
+	Pol q = Pol(x)*y + Pol(x)*z;
+	carl::substitute_inplace(q, std::map<Variable, Rational>({{y, Rational(1)}, {z, Rational(-1)}}));
+	EXPECT_TRUE(carl::isZero(q));
+}
+
+TEST(MultivariatePolynomial, SubstituteManyMixedTypes)
+{
+	// Ids are only unique per type, hence we create variables until a real and an integer variable share their id.
+	Variable x = freshRealVariable();
+	Variable n = freshIntegerVariable();
+	while (n.id() < x.id()) n = freshIntegerVariable();
+	while (x.id() < n.id()) x = freshRealVariable();
+	ASSERT_EQ(x.id(), n.id());
+	using Pol = MultivariatePolynomial<Rational>;
+	Pol p = Pol(x) + Pol(n);
+	carl::substitute_inplace(p, std::map<Variable, Rational>({{x, Rational(2)}}));
+	EXPECT_EQ(Pol(n) + Pol(Rational(2)), p);
+	Pol q = Pol(x)*x*n + Pol(n)*n;
+	carl::substitute_inplace(q, std::map<Variable, Rational>({{n, Rational(-1)}}));
+	EXPECT_EQ(-Pol(x)*x + Pol(Rational(1)), q);
+}
+
 TEST(MultivariatePolynomial, SPolynomial)
 {
     Variable x = freshRealVariable("x");
@@ -590,6 +637,143 @@ TYPED_TEST(MultivariatePolynomialTest, MultivariatePolynomialMultiplication)
             MultivariatePolynomial<TypeParam>({(TypeParam)1*x*y}) * MultivariatePolynomial<TypeParam>({(TypeParam)8*x, Term<TypeParam>(6), (TypeParam)9*y}));
 }
 
+TYPED_TEST(MultivariatePolynomialTest, HeapMultiplication)
+{
+    Variable x = freshRealVariable("x");
+    Variable y = freshRealVariable("y");
+    Variable z = freshRealVariable("z");
+
+    auto power = [](Variable v, int e) {
+        MultivariatePolynomial<TypeParam> res(TypeParam(1));
+        for (int i = 0; i < e; ++i) res *= v;
+        return res;
+    };
+    MultivariatePolynomial<TypeParam> p(TypeParam(1));
+    MultivariatePolynomial<TypeParam> q(TypeParam(-3));
+    for (int i = 1; i < 30; ++i) {
+        p += TypeParam(i) * power(x, i % 7) * power(y, i % 5);
+        q += TypeParam(i % 4 - 2) * power(y, i % 3) * power(z, i % 6);
+    }
+    q += TypeParam(5) * x;
+    for (const auto& rhs: {p, q, MultivariatePolynomial<TypeParam>(x) - y, MultivariatePolynomial<TypeParam>(TypeParam(7))}) {
+        MultivariatePolynomial<TypeParam> heap(p);
+        heap.multiplyHeap(rhs);
+        MultivariatePolynomial<TypeParam> tam(p);
+        tam.multiplyTermAddition(rhs);
+        EXPECT_TRUE(heap.isOrdered());
+        EXPECT_EQ(tam, heap);
+        EXPECT_EQ(tam, p * rhs);
+    }
+    // The product cancels to x^2 - y^2.
+    MultivariatePolynomial<TypeParam> a = MultivariatePolynomial<TypeParam>(x) + y;
+    a.multiplyHeap(MultivariatePolynomial<TypeParam>(x) - y);
+    EXPECT_EQ(MultivariatePolynomial<TypeParam>({TypeParam(1)*x*x, TypeParam(-1)*y*y}), a);
+}
+
+#ifdef THREAD_SAFE
+TEST(MultivariatePolynomial, ConcurrentConstruction)
+{
+    Variable x = freshRealVariable("x");
+    Variable y = freshRealVariable("y");
+    auto build = [x,y](int offset) {
+        MultivariatePolynomial<Rational> p{Rational(offset)};
+        for (int i = 1; i < 50; ++i) {
+            p += Rational(i + offset) * x * y;
+            p *= MultivariatePolynomial<Rational>(x) + Rational(i % 3);
+            p = p - Rational(i) * x;
+        }
+        return p;
+    };
+    std::vector<MultivariatePolynomial<Rational>> results(4);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < results.size(); ++t) {
+        threads.emplace_back([&results, &build, t]() { results[t] = build(static_cast<int>(t)); });
+    }
+    for (auto& t: threads) t.join();
+    for (std::size_t t = 0; t < results.size(); ++t) {
+        EXPECT_EQ(build(static_cast<int>(t)), results[t]);
+    }
+}
+#endif
+
+TEST(MultivariatePolynomial, ArenaAllocator)
+{
+    using ArenaPolynomial = MultivariatePolynomial<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<NoReasons, ArenaAllocator>>;
+    Variable x = freshRealVariable("x");
+    Variable y = freshRealVariable("y");
+    auto build = [x,y](auto& p) {
+        for (int i = 1; i < 20; ++i) {
+            p += Rational(i) * x * y;
+            p *= std::decay_t<decltype(p)>(x) + Rational(i % 3);
+            p = p - Rational(i) * y;
+        }
+    };
+    MultivariatePolynomial<Rational> expected(Rational(2));
+    build(expected);
+
+    PolynomialArena arena(1024);
+    ArenaPolynomial result;
+    ArenaPolynomial moved;
+    EXPECT_EQ(nullptr, result.getTerms().get_allocator().arena());
+    {
+        PolynomialArenaScope scope(arena);
+        ArenaPolynomial p(Rational(2));
+        build(p);
+        EXPECT_EQ(&arena, p.getTerms().get_allocator().arena());
+        EXPECT_TRUE(arena.allocated() > 0);
+        {
+            PolynomialArenaScope heap(nullptr);
+            result = ArenaPolynomial(p);
+        }
+        // Move assignment keeps the heap storage of the target.
+        moved = std::move(p);
+    }
+    EXPECT_EQ(nullptr, result.getTerms().get_allocator().arena());
+    EXPECT_EQ(nullptr, moved.getTerms().get_allocator().arena());
+    arena.release();
+    EXPECT_EQ(0, arena.allocated());
+    EXPECT_EQ(1, arena.chunks());
+    ASSERT_EQ(expected.nrTerms(), result.nrTerms());
+    ASSERT_EQ(expected.nrTerms(), moved.nrTerms());
+    for (std::size_t i = 0; i < expected.nrTerms(); ++i) {
+        EXPECT_EQ(expected[i], result[i]);
+        EXPECT_EQ(expected[i], moved[i]);
+    }
+}
+
+TEST(MultivariatePolynomial, ArenaAllocatorMoveConstruction)
+{
+    using ArenaPolynomial = MultivariatePolynomial<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<NoReasons, ArenaAllocator>>;
+    Variable x = freshRealVariable("x");
+    Variable y = freshRealVariable("y");
+    MultivariatePolynomial<Rational> expected = Rational(3) * x * y + Rational(2) * x - y;
+
+    PolynomialArena arena(1024);
+    std::vector<ArenaPolynomial> polys;
+    ArenaPolynomial swapped(Rational(1));
+    {
+        PolynomialArenaScope scope(arena);
+        ArenaPolynomial p({Rational(3) * x * y, Rational(2) * x, Rational(-1) * y});
+        ArenaPolynomial q = p;
+        ASSERT_EQ(&arena, p.getTerms().get_allocator().arena());
+        // Move construction copies the terms to the heap.
+        polys.push_back(std::move(p));
+        EXPECT_EQ(nullptr, polys.back().getTerms().get_allocator().arena());
+        // Swapping keeps the storage of both sides.
+        std::swap(q, swapped);
+        EXPECT_EQ(&arena, q.getTerms().get_allocator().arena());
+        EXPECT_EQ(nullptr, swapped.getTerms().get_allocator().arena());
+    }
+    arena.release();
+    ASSERT_EQ(1, polys.size());
+    ASSERT_EQ(expected.nrTerms(), polys.back().nrTerms());
+    ASSERT_EQ(expected.nrTerms(), swapped.nrTerms());
+    for (std::size_t i = 0; i < expected.nrTerms(); ++i) {
+        EXPECT_EQ(expected[i], polys.back()[i]);
+        EXPECT_EQ(expected[i], swapped[i]);
+    }
+}
+
 TYPED_TEST(MultivariatePolynomialTest, CreationViaOperators)
 {
     Variable x = freshRealVariable("x");
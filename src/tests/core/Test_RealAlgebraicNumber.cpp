@@ -73,3 +73,38 @@ TEST(RealAlgebraicNumber, EvalBug)
 
 
 
+
+
+TEST(RealAlgebraicNumber, DoubleFilter)
+{
+	using carl::ran::interval::double_interval;
+	Variable x = freshRealVariable("x");
+
+	auto sq = carl::ran::interval::pow(double_interval{-2, 1}, 2);
+	EXPECT_TRUE(sq.lower <= 0 && 0 <= sq.lower + 1e-300);
+	EXPECT_TRUE(4 <= sq.upper && sq.upper < 4.000001);
+
+	real_algebraic_number_interval<Rational> sqrt2(UnivariatePolynomial<Rational>(x, {-2, 0, 1}), Interval<Rational>(1, BoundType::STRICT, 2, BoundType::STRICT));
+	real_algebraic_number_interval<Rational> sqrt3(UnivariatePolynomial<Rational>(x, {-3, 0, 1}), Interval<Rational>(1, BoundType::STRICT, 2, BoundType::STRICT));
+	const auto& approx = sqrt2.approximation();
+	EXPECT_TRUE(approx.lower <= std::sqrt(2.0) && std::sqrt(2.0) <= approx.upper);
+	EXPECT_LT(approx.upper - approx.lower, 1e-12);
+
+	// Decided by the filter without refining the isolating intervals.
+	EXPECT_TRUE(sqrt2 < sqrt3);
+	EXPECT_EQ(Interval<Rational>(1, BoundType::STRICT, 2, BoundType::STRICT), sqrt2.interval());
+	EXPECT_TRUE(sqrt2 > Rational(Rational(14142135) / 10000000));
+	EXPECT_TRUE(sqrt2 < Rational(Rational(14142136) / 10000000));
+	EXPECT_EQ(Sign::POSITIVE, sqrt2.sgn(UnivariatePolynomial<Rational>(x, {-1, 1})));
+	// Inconclusive, decided exactly.
+	EXPECT_EQ(Sign::ZERO, sqrt2.sgn(UnivariatePolynomial<Rational>(x, {-4, 0, 2})));
+	EXPECT_TRUE(sqrt2 == real_algebraic_number_interval<Rational>(UnivariatePolynomial<Rational>(x, {-2, 0, 1}), Interval<Rational>(0, BoundType::STRICT, 3, BoundType::STRICT)));
+
+	MultivariatePolynomial<Rational> p = MultivariatePolynomial<Rational>(x) * x - Rational(2);
+	std::map<Variable, real_algebraic_number_interval<Rational>> m;
+	m.emplace(x, sqrt3);
+	EXPECT_TRUE(carl::evaluate(Constraint<MultivariatePolynomial<Rational>>(p, Relation::GREATER), m));
+	m.clear();
+	m.emplace(x, sqrt2);
+	EXPECT_TRUE(carl::evaluate(Constraint<MultivariatePolynomial<Rational>>(p, Relation::EQ), m));
+}
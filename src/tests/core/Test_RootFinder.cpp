@@ -167,6 +167,110 @@ TEST(RootFinder, Chebyshev)
 	}
 }
 
+TEST(RootFinder, IsolationStrategies)
+{
+	using carl::ran::interval::IsolationStrategy;
+	carl::Variable x = freshRealVariable("x");
+	carl::Chebyshev<Rational> chebyshev(x);
+	std::vector<UPolynomial> polys = {
+		chebyshev(30),
+		// Mignotte-like polynomial with two roots close to 1/10
+		UPolynomial(x, {-2, 40, -200, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1}),
+		UPolynomial(x, {2, -7, 7, -2}),
+	};
+	// Clustered roots 1, 1 + 1/1000, ..., 1 + 7/1000 and the rational root 2
+	UPolynomial clustered(x, {-2, 1});
+	for (int i = 0; i < 8; ++i) {
+		clustered *= UPolynomial(x, {-1 - Rational(i) / 1000, 1});
+	}
+	polys.emplace_back(clustered);
+
+	for (const auto& p: polys) {
+		auto reference = ran::interval::RealRootIsolation<Rational>(p, Interval<Rational>::unboundedInterval(), IsolationStrategy::Bisection).get_roots();
+		for (auto strategy: {IsolationStrategy::VCA, IsolationStrategy::Sturm}) {
+			auto roots = ran::interval::RealRootIsolation<Rational>(p, Interval<Rational>::unboundedInterval(), strategy).get_roots();
+			EXPECT_EQ(reference, roots) << "Strategy " << strategy << " on " << p;
+		}
+	}
+	auto roots = ran::interval::RealRootIsolation<Rational>(clustered, Interval<Rational>::unboundedInterval()).get_roots();
+	EXPECT_EQ(9, roots.size());
+}
+
+TEST(RootFinder, StrictBoundsAreRoots)
+{
+	using carl::ran::interval::IsolationStrategy;
+	carl::Variable x = freshRealVariable("x");
+	// Roots 1 and 3 on the bounds, sqrt(2), sqrt(3) and sqrt(5) in between
+	UPolynomial p(x, {-3, 1});
+	p *= UPolynomial(x, {-1, 1});
+	p *= UPolynomial(x, {-2, 0, 1});
+	p *= UPolynomial(x, {-3, 0, 1});
+	p *= UPolynomial(x, {-5, 0, 1});
+	Interval<Rational> interval(1, BoundType::STRICT, 3, BoundType::STRICT);
+	for (auto strategy: {IsolationStrategy::Bisection, IsolationStrategy::VCA, IsolationStrategy::Sturm}) {
+		auto roots = ran::interval::RealRootIsolation<Rational>(p, interval, strategy).get_roots();
+		ASSERT_EQ(3, roots.size()) << "Strategy " << strategy;
+		for (const auto& r: roots) {
+			EXPECT_TRUE(r > Rational(1) && r < Rational(3)) << "Strategy " << strategy << ": " << r;
+		}
+	}
+}
+
+TEST(RootFinder, BatchRealRoots)
+{
+	carl::Variable x = freshRealVariable("x");
+	UPolynomial sqrt2(x, {-2, 0, 1});
+	UPolynomial one(x, {-1, 1});
+	UPolynomial mthree(x, {3, 1});
+	std::vector<UPolynomial> polys = {
+		one * sqrt2,
+		sqrt2 * sqrt2 * mthree,
+		one * one * one,
+		UPolynomial(x),
+		UPolynomial(x, {5}),
+	};
+	auto res = carl::batchRealRoots(polys);
+	ASSERT_EQ(4, res.roots.size());
+	EXPECT_TRUE(represents(res.roots[0], Rational(-3)));
+	EXPECT_TRUE(represents(res.roots[2], Rational(1)));
+	EXPECT_EQ((std::vector<bool>{false, false, false, true, false}), res.nullified);
+	using Multiplicities = std::vector<std::pair<std::size_t, std::size_t>>;
+	EXPECT_EQ((Multiplicities{{1, 1}, {2, 1}, {3, 1}}), res.multiplicities[0]);
+	EXPECT_EQ((Multiplicities{{0, 1}, {1, 2}, {3, 2}}), res.multiplicities[1]);
+	EXPECT_EQ((Multiplicities{{2, 3}}), res.multiplicities[2]);
+	EXPECT_TRUE(res.multiplicities[3].empty());
+	EXPECT_TRUE(res.multiplicities[4].empty());
+
+	for (std::size_t i = 0; i < 3; ++i) {
+		std::vector<carl::RealAlgebraicNumber<Rational>> batched;
+		for (const auto& m: res.multiplicities[i]) {
+			batched.emplace_back(res.roots[m.first]);
+		}
+		EXPECT_EQ(carl::realRoots(polys[i]), batched) << "Roots of " << polys[i];
+	}
+}
+
+TEST(RootFinder, SquareFreeBasis)
+{
+	carl::Variable x = freshRealVariable("x");
+	UPolynomial a(x, {-3, 3});
+	UPolynomial b(x, {1, 2});
+	UPolynomial c(x, {-4, 0, 3});
+	std::vector<UPolynomial> polys = { a * b * Rational(5), b * b * c, a * c * Rational(-2) };
+	auto res = carl::squareFreeBasis(polys);
+	EXPECT_EQ(3, res.basis.size());
+	for (const auto& p: res.basis) {
+		EXPECT_EQ(Rational(1), p.lcoeff()) << p << " is not monic";
+	}
+	for (std::size_t i = 0; i < polys.size(); ++i) {
+		UPolynomial product(x, {polys[i].lcoeff()});
+		for (const auto& f: res.factors[i]) {
+			product *= carl::pow(res.basis[f.first], f.second);
+		}
+		EXPECT_EQ(polys[i], product);
+	}
+}
+
 using Poly = carl::UnivariatePolynomial<mpq_class>;
 TEST(RootFinder, Comparison)
 {
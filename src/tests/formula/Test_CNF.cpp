@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+#include "../../carl/core/VariablePool.h"
+#include "../../carl/formula/Formula.h"
+#include "../../carl/formula/helpers/to_cnf.h"
+
+#include "../Common.h"
+
+using namespace carl;
+
+typedef MultivariatePolynomial<Rational> Pol;
+typedef Formula<Pol> FormulaT;
+
+TEST(CNF, ToCNF)
+{
+	FormulaT a(freshBooleanVariable("a"));
+	FormulaT b(freshBooleanVariable("b"));
+	FormulaT c(freshBooleanVariable("c"));
+	FormulaT f(FormulaType::OR, {FormulaT(FormulaType::AND, {a, b}), c});
+	FormulaT cnf = to_cnf(f);
+	EXPECT_TRUE(cnf.propertyHolds(PROP_IS_IN_CNF));
+	EXPECT_EQ(FormulaType::AND, cnf.getType());
+	EXPECT_EQ(FormulaT(FormulaType::FALSE), to_cnf(FormulaT(FormulaType::AND, {f, FormulaT(FormulaType::FALSE)})));
+}
+
+TEST(CNF, Encoder)
+{
+	FormulaT a(freshBooleanVariable("a"));
+	FormulaT b(freshBooleanVariable("b"));
+	FormulaT c(freshBooleanVariable("c"));
+	FormulaT d(freshBooleanVariable("d"));
+	FormulaT ab(FormulaType::AND, {a, b});
+
+	Formulas<Pol> clauses;
+	CNFEncoder<Pol> encoder([&clauses](const FormulaT& clause){ clauses.push_back(clause); });
+	encoder.add(FormulaT(FormulaType::OR, {ab, c}));
+	// The clause with the tseitin variable and three clauses defining it.
+	EXPECT_EQ(4, clauses.size());
+	for (const auto& clause: clauses) {
+		EXPECT_TRUE(clause.isLiteral() || clause.getType() == FormulaType::OR);
+	}
+	FormulaT tseitin = FormulaPool<Pol>::getInstance().getTseitinVar(ab);
+	EXPECT_EQ(FormulaType::BOOL, tseitin.getType());
+
+	// The tseitin variable is reused without being defined again.
+	clauses.clear();
+	encoder.add(FormulaT(FormulaType::OR, {ab, d}));
+	ASSERT_EQ(1, clauses.size());
+	EXPECT_EQ(FormulaT(FormulaType::OR, {tseitin, d}), clauses.front());
+
+	clauses.clear();
+	encoder.add(FormulaT(FormulaType::AND, {c, FormulaT(FormulaType::NOT, d)}));
+	EXPECT_EQ(2, clauses.size());
+	EXPECT_EQ(7, encoder.clauses());
+}
+
+TEST(CNF, LiteralMap)
+{
+	FormulaT a(freshBooleanVariable("a"));
+	FormulaT b(freshBooleanVariable("b"));
+
+	std::vector<std::vector<int>> clauses;
+	CNFLiteralMap<Pol> literals([&clauses](const int* lits, std::size_t size){ clauses.emplace_back(lits, lits + size); });
+	CNFEncoder<Pol> encoder(std::ref(literals));
+	encoder.add(FormulaT(FormulaType::OR, {a, FormulaT(FormulaType::NOT, b)}));
+	encoder.add(b);
+	encoder.add(FormulaT(FormulaType::FALSE));
+	ASSERT_EQ(3, clauses.size());
+	EXPECT_EQ(2, literals.size());
+	EXPECT_EQ(2, clauses[0].size());
+	EXPECT_EQ(std::vector<int>({static_cast<int>(literals.size())}), clauses[1]);
+	EXPECT_EQ(b, literals.atom(clauses[1].front()));
+	EXPECT_TRUE(clauses[2].empty());
+	for (int lit: clauses[0]) {
+		if (lit < 0) EXPECT_EQ(b, literals.atom(-lit));
+		else EXPECT_EQ(a, literals.atom(lit));
+	}
+}
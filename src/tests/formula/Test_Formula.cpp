@@ -1,10 +1,13 @@
 #include <gtest/gtest.h>
 #include "../../carl/core/VariablePool.h"
 #include "../../carl/formula/Formula.h"
+#include "../../carl/formula/helpers/FormulaVisitor.h"
 #include "../../carl/util/stringparser.h"
 
 #include "../Common.h"
 
+#include <thread>
+
 using namespace carl;
 
 typedef MultivariatePolynomial<Rational> Pol;
@@ -107,6 +110,72 @@ TEST(Formula, FormulaPoolDestructor)
     FormulaT test(AND, {FormulaT(b1), FormulaT(b2)});
 }
 
+TEST(Formula, FormulaPoolReclamation)
+{
+    auto& pool = FormulaPool<Pol>::getInstance();
+    pool.collectGarbage();
+    pool.collectGarbage();
+    std::size_t before = pool.size();
+    carl::Variable b1 = freshBooleanVariable("b1");
+    carl::Variable b2 = freshBooleanVariable("b2");
+    {
+        FormulaT a(b1);
+        FormulaT b(b2);
+        FormulaT f(AND, {a, b});
+        FormulaT g(OR, {f, FormulaT(NOT, a)});
+        FormulaT copy = g;
+        EXPECT_EQ(before + 4, pool.size());
+    }
+    pool.collectGarbage();
+    EXPECT_EQ(before, pool.size());
+    FormulaT a(b1);
+    EXPECT_EQ(before + 1, pool.size());
+    pool.collectGarbage();
+    EXPECT_EQ(before + 1, pool.size());
+    {
+        // The last usage of a dies while the conjunction is created, which returns its content.
+        FormulaT f(AND, Formulas<Pol>({std::move(a)}));
+        EXPECT_EQ(FormulaType::BOOL, f.getType());
+        pool.collectGarbage();
+        EXPECT_EQ(before + 1, pool.size());
+        EXPECT_EQ(b1, f.boolean());
+    }
+    pool.collectGarbage();
+    EXPECT_EQ(before, pool.size());
+}
+
+#ifdef THREAD_SAFE
+TEST(Formula, ConcurrentReclamation)
+{
+    std::vector<carl::Variable> vars;
+    for (int i = 0; i < 8; ++i) vars.push_back(freshBooleanVariable());
+    // All threads create and drop the same formulas, such that contents die and are looked up again while other threads reclaim.
+    auto build = [&vars](std::size_t offset) {
+        std::size_t count = 0;
+        for (std::size_t round = 0; round < 1000; ++round) {
+            Formulas<Pol> subformulas;
+            for (std::size_t i = 0; i < vars.size(); ++i) {
+                FormulaT v(vars[(i + offset + round) % vars.size()]);
+                subformulas.emplace_back(i % 2 == 0 ? v : FormulaT(NOT, v));
+            }
+            FormulaT f(OR, subformulas);
+            FormulaT g(AND, {f, FormulaT(vars[round % vars.size()])});
+            count += g.size();
+        }
+        return count;
+    };
+    std::vector<std::size_t> results(4);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < results.size(); ++t) {
+        threads.emplace_back([&results, &build, t]() { results[t] = build(t); });
+    }
+    for (auto& t: threads) t.join();
+    for (std::size_t t = 0; t < results.size(); ++t) {
+        EXPECT_EQ(build(t), results[t]);
+    }
+}
+#endif
+
 TEST(Formula, ANDConstruction)
 {
     FormulaT a( freshBooleanVariable("a") );
@@ -404,3 +473,74 @@ TEST(Formula, Uniqueness)
 	FormulaT f2 = FormulaT(vc);
 	EXPECT_EQ(f1, f2);
 }
+
+TEST(Formula, VisitorSharedSubformulas)
+{
+	Variable x = freshRealVariable("x");
+	FormulaT atom(Pol(x), Relation::LESS);
+	FormulaT f = atom;
+	std::size_t depth = 16;
+	for (std::size_t i = 0; i < depth; ++i) {
+		FormulaT b(freshBooleanVariable());
+		f = FormulaT(FormulaType::AND, {f, FormulaT(FormulaType::OR, {f, b})});
+	}
+	FormulaVisitor<FormulaT> visitor;
+	std::size_t visited = 0;
+	visitor.visit(f, [&visited](const FormulaT&){ ++visited; });
+	// atom, and for every level: a boolean variable, the disjunction and the conjunction
+	EXPECT_EQ(1 + 3 * depth, visited);
+	// the complexity still counts every occurrence
+	std::function<std::size_t(const FormulaT&)> complexity = [&](const FormulaT& cur) {
+		std::size_t res = cur.getType() == FormulaType::CONSTRAINT ? cur.constraint().complexity() : 1;
+		FormulaVisitor<FormulaT>::forallSubformulas(cur, [&](const FormulaT& sub){ res += complexity(sub); });
+		return res;
+	};
+	EXPECT_EQ(complexity(f), f.complexity());
+
+	FormulaSubstitutor<FormulaT> substitutor;
+	FormulaT res = substitutor.substitute(f, std::map<Variable,Pol>({{x, Pol(Rational(1))}}));
+	EXPECT_EQ(FormulaT(FormulaType::FALSE), res);
+	res = substitutor.substitute(f, atom, FormulaT(FormulaType::TRUE));
+	EXPECT_EQ(FormulaT(FormulaType::TRUE), res);
+}
+
+TEST(Formula, VisitorNested)
+{
+	Variable x = freshRealVariable("x");
+	FormulaT atom(Pol(x), Relation::LESS);
+	FormulaT b(freshBooleanVariable());
+	FormulaT f(FormulaType::AND, {atom, FormulaT(FormulaType::OR, {atom, b})});
+	FormulaVisitor<FormulaT> visitor;
+	// The same visitor traverses every subformula again from within the callbacks.
+	std::size_t outer = 0;
+	std::size_t inner = 0;
+	visitor.visit(f, [&](const FormulaT& cur) {
+		++outer;
+		visitor.visit(cur, [&inner](const FormulaT&){ ++inner; });
+	});
+	EXPECT_EQ(4, outer);
+	// atom: 1, b: 1, the disjunction: 3, the conjunction: 4
+	EXPECT_EQ(9, inner);
+	FormulaT res = visitor.visitResult(f, [&](const FormulaT& cur) {
+		std::size_t count = 0;
+		visitor.visit(cur, [&count](const FormulaT&){ ++count; });
+		if (cur.getType() == FormulaType::CONSTRAINT) {
+			return visitor.visitResult(cur, [](const FormulaT&){ return FormulaT(FormulaType::TRUE); });
+		}
+		return cur;
+	});
+	EXPECT_EQ(FormulaT(FormulaType::TRUE), res);
+}
+
+TEST(Formula, VisitorDeepFormula)
+{
+	FormulaT f(freshBooleanVariable());
+	std::size_t depth = 100000;
+	for (std::size_t i = 0; i < depth; ++i) {
+		f = FormulaT(FormulaType::OR, {FormulaT(FormulaType::NOT, f), FormulaT(freshBooleanVariable())});
+	}
+	FormulaVisitor<FormulaT> visitor;
+	std::size_t visited = 0;
+	visitor.visit(f, [&visited](const FormulaT&){ ++visited; });
+	EXPECT_EQ(1 + 3 * depth, visited);
+}
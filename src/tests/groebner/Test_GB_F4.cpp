@@ -0,0 +1,66 @@
+#include "gtest/gtest.h"
+#include "carl/groebner/groebner.h"
+#include "carl/groebner/benchmarks/cyclic.h"
+#include "carl/groebner/benchmarks/katsura.h"
+#include "carl/util/platform.h"
+
+#include "../Common.h"
+
+using namespace carl;
+
+using Pol = MultivariatePolynomial<Rational>;
+
+template<template<typename, template<typename> class> class Procedure>
+std::vector<Pol> computeBasis(const std::vector<Pol>& input)
+{
+	GBProcedure<Pol, Procedure, StdAdding> gb;
+	for (const auto& p: input) gb.addPolynomial(p);
+	gb.reduceInput();
+	gb.calculate();
+	std::vector<Pol> res = gb.getBasisPolynomials();
+	std::sort(res.begin(), res.end(), [](const Pol& lhs, const Pol& rhs){
+		return GrLexOrdering::less(lhs.lmon(), rhs.lmon());
+	});
+	return res;
+}
+
+TEST(GB_F4, T1)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+
+	Pol f1({(Rational)1*x*x*x, (Rational)-2*x*y} );
+	Pol f2({(Rational)1*x*x*y, (Rational)-2*y*y, (Rational)1*x});
+	GBProcedure<Pol, F4, StdAdding> gbobject;
+	gbobject.addPolynomial(f1);
+	gbobject.addPolynomial(f2);
+	gbobject.reduceInput();
+	gbobject.calculate();
+	EXPECT_EQ(Pol({(Rational)1*x*x}), gbobject.getIdeal().getGenerator(0));
+	EXPECT_EQ(Pol({(Rational)1*x*y}), gbobject.getIdeal().getGenerator(1));
+	EXPECT_EQ(Pol({(Rational)1*y*y, (Rational)-1*(Rational)1/(Rational)2*x}), gbobject.getIdeal().getGenerator(2));
+}
+
+TEST(GB_F4, Inconsistent)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+
+	GBProcedure<Pol, F4, StdAdding> gbobject;
+	gbobject.addPolynomial(Pol(x)*y - Rational(1));
+	gbobject.addPolynomial(Pol(x)*x);
+	gbobject.calculate();
+	EXPECT_TRUE(gbobject.basisIsConstant());
+}
+
+TEST(GB_F4, CompareWithBuchberger)
+{
+	for (unsigned i = 2; i <= 5; ++i) {
+		auto input = carl::benchmarks::katsura<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<>>(i);
+		EXPECT_EQ(computeBasis<Buchberger>(input), computeBasis<F4>(input)) << "katsura " << i;
+	}
+	for (unsigned i = 2; i <= 5; ++i) {
+		auto input = carl::benchmarks::cyclic<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<>>(i);
+		EXPECT_EQ(computeBasis<Buchberger>(input), computeBasis<F4>(input)) << "cyclic " << i;
+	}
+}
@@ -0,0 +1,98 @@
+#include "gtest/gtest.h"
+#include "carl/groebner/groebner.h"
+#include "carl/groebner/benchmarks/cyclic.h"
+#include "carl/groebner/benchmarks/katsura.h"
+#include "carl/util/platform.h"
+
+#include "../Common.h"
+
+using namespace carl;
+
+using Pol = MultivariatePolynomial<Rational>;
+
+template<template<typename, template<typename> class> class Procedure>
+std::vector<Pol> modularBasis(const std::vector<Pol>& input)
+{
+	GBProcedure<Pol, Procedure, StdAdding> gb;
+	for (const auto& p: input) gb.addPolynomial(p);
+	gb.reduceInput();
+	gb.calculate();
+	std::vector<Pol> res = gb.getBasisPolynomials();
+	std::sort(res.begin(), res.end(), [](const Pol& lhs, const Pol& rhs){
+		return GrLexOrdering::less(lhs.lmon(), rhs.lmon());
+	});
+	return res;
+}
+
+TEST(GB_Modular, RationalCoefficients)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+
+	std::vector<Pol> input({
+		Pol(x)*x*Rational(3,7) - Pol(y)*z*Rational(11,5) + Rational(1,3),
+		Pol(x)*y*Rational(-13,2) + Pol(z)*Rational(17,19),
+		Pol(y)*y + Pol(x)*z*Rational(5,23) - Rational(2)
+	});
+	EXPECT_EQ(modularBasis<F4>(input), modularBasis<ModularGB>(input));
+}
+
+TEST(GB_Modular, Inconsistent)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+
+	GBProcedure<Pol, ModularGB, StdAdding> gbobject;
+	gbobject.addPolynomial(Pol(x)*y - Rational(1));
+	gbobject.addPolynomial(Pol(x)*x*Rational(1,2));
+	gbobject.calculate();
+	EXPECT_TRUE(gbobject.basisIsConstant());
+}
+
+TEST(GB_Modular, CompareWithF4)
+{
+	for (unsigned i = 2; i <= 5; ++i) {
+		auto input = carl::benchmarks::katsura<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<>>(i);
+		EXPECT_EQ(modularBasis<F4>(input), modularBasis<ModularGB>(input)) << "katsura " << i;
+	}
+	for (unsigned i = 2; i <= 5; ++i) {
+		auto input = carl::benchmarks::cyclic<Rational, GrLexOrdering, StdMultivariatePolynomialPolicies<>>(i);
+		EXPECT_EQ(modularBasis<F4>(input), modularBasis<ModularGB>(input)) << "cyclic " << i;
+	}
+}
+
+TEST(GB_Modular, LargeCoefficients)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+
+	// The basis has coefficients of several hundred bits, which need more than 30 primes.
+	Rational a = Rational(carl::pow(mpz_class(3), 97) + 1, carl::pow(mpz_class(5), 71));
+	Rational b = Rational(carl::pow(mpz_class(7), 83), carl::pow(mpz_class(2), 211) - 1);
+	std::vector<Pol> input({
+		Pol(x)*y - a*Pol(z) + Rational(1),
+		Pol(y)*y - b*Pol(x) + a,
+		Pol(z)*z*Rational(3) + Pol(x)*b - Pol(y)
+	});
+	EXPECT_EQ(modularBasis<F4>(input), modularBasis<ModularGB>(input));
+}
+
+struct ModularGBVerification: public ModularGB<Pol, StdAdding>
+{
+	using ModularGB<Pol, carl::StdAdding>::verify;
+};
+
+TEST(GB_Modular, Verify)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+
+	std::vector<Pol> input({ Pol(x)*y - Rational(1), Pol(x)*x - Pol(y) });
+	EXPECT_TRUE(ModularGBVerification::verify(input, modularBasis<F4>(input)));
+	// x^2 - y does not reduce to zero.
+	EXPECT_FALSE(ModularGBVerification::verify(input, { Pol(x)*y - Rational(1) }));
+	// The S-polynomial y^2 - x does not reduce to zero.
+	EXPECT_FALSE(ModularGBVerification::verify(input, input));
+}
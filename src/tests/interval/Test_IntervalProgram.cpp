@@ -0,0 +1,149 @@
+#include "gtest/gtest.h"
+#include "carl/core/MultivariateHorner.h"
+#include "carl/core/VariablePool.h"
+#include "carl/interval/Interval.h"
+#include "carl/interval/IntervalEvaluation.h"
+#include "carl/interval/IntervalProgram.h"
+#include "carl/interval/set_theory.h"
+
+#include "../Common.h"
+
+using namespace carl;
+
+TEST(IntervalProgram, Evaluate)
+{
+	Variable a = freshRealVariable("a");
+	Variable b = freshRealVariable("b");
+	Variable c = freshRealVariable("c");
+	Variable d = freshRealVariable("d");
+	std::map<Variable, Interval<Rational>> map;
+	map[a] = Interval<Rational>(1, 4);
+	map[b] = Interval<Rational>(2, 5);
+	map[c] = Interval<Rational>(-2, 3);
+	map[d] = Interval<Rational>(0, 2);
+
+	using Pol = MultivariatePolynomial<Rational>;
+	Pol e1 = Pol(a) + b + c + d;
+	Pol e2 = Pol(a) * b * c + d;
+	Pol e3 = Pol(a) * Rational(12) + Pol(b) * Rational(3) + Pol(c) * c - Pol(d) * d * d;
+	Pol e4 = carl::pow(Pol(a) + c, 2) * b * d + a + Rational(7);
+	Pol e5 = carl::pow(Pol(a) * b - Pol(c) * d, 3) * Rational(1, 2) - Pol(a) * b;
+
+	IntervalProgram<Rational> program;
+	std::vector<std::size_t> outputs;
+	for (const auto& p: { e1, e2, e3, e4, e5 }) {
+		outputs.emplace_back(program.add(p));
+	}
+	EXPECT_EQ(4, program.variables().size());
+	auto box = program.box(map);
+	EXPECT_EQ(Interval<Rational>(1, 14), program.evaluate(box, outputs[0]));
+	EXPECT_EQ(Interval<Rational>(-40, 62), program.evaluate(box, outputs[1]));
+	EXPECT_EQ(Interval<Rational>(10, 72), program.evaluate(box, outputs[2]));
+	std::size_t i = 0;
+	for (const auto& p: { e1, e2, e3, e4, e5 }) {
+		EXPECT_EQ(IntervalEvaluation::evaluate(p, map), program.evaluate(box, outputs[i++]));
+	}
+
+	// Subexpressions are shared between polynomials.
+	std::size_t size = program.size();
+	std::size_t e6 = program.add(Pol(a) * b * c);
+	EXPECT_EQ(size, program.size());
+	EXPECT_EQ(Interval<Rational>(-40, 60), program.evaluate(box, e6));
+	program.add(Pol(c) * c * Rational(3));
+	EXPECT_EQ(size + 1, program.size());
+}
+
+TEST(IntervalProgram, Horner)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	using Pol = MultivariatePolynomial<Rational>;
+	Pol p = Pol(x) * x * y + Pol(x) * y * y + Pol(x) * Rational(3) - Pol(y) + Rational(2);
+	MultivariateHorner<Pol, strategy> h(p);
+
+	std::map<Variable, Interval<Rational>> map;
+	map[x] = Interval<Rational>(-1, 2);
+	map[y] = Interval<Rational>(1, 3);
+
+	IntervalProgram<Rational> program;
+	std::size_t out = program.add(h);
+	EXPECT_EQ(IntervalEvaluation::evaluate(h, map), program.evaluate(program.box(map), out));
+}
+
+TEST(IntervalProgram, Contract)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	using Pol = MultivariatePolynomial<Rational>;
+
+	// x^2 + y^2 = 1 with y >= 0.9
+	IntervalProgram<double> program;
+	std::size_t circle = program.add(Pol(x) * x + Pol(y) * y - Rational(1));
+	auto box = program.box({ {x, Interval<double>(-2, 2)}, {y, Interval<double>(0.9, 2.0)} });
+	EXPECT_TRUE(program.contract(box, circle, Interval<double>(0)));
+	const auto& bx = box[program.slot(x)];
+	const auto& by = box[program.slot(y)];
+	EXPECT_TRUE(bx.contains(Interval<double>(-0.43, 0.43)));
+	EXPECT_TRUE(Interval<double>(-0.44, 0.44).contains(bx));
+	EXPECT_TRUE(by.contains(Interval<double>(0.9, 1.0)));
+	EXPECT_TRUE(Interval<double>(0.89, 1.01).contains(by));
+
+	// x * y >= 3 contracts x from below.
+	std::size_t prod = program.add(Pol(x) * y);
+	auto box2 = program.box({ {x, Interval<double>(-2, 2)}, {y, Interval<double>(1, 2)} });
+	EXPECT_TRUE(program.contract(box2, prod, Interval<double>(3.0, BoundType::WEAK, 0.0, BoundType::INFTY)));
+	EXPECT_TRUE(Interval<double>(1.49, 2.0).contains(box2[program.slot(x)]));
+	EXPECT_TRUE(Interval<double>(1.49, 2.0).contains(box2[program.slot(y)]));
+
+	// x^3 = -8 projects to the negative root.
+	std::size_t cube = program.add(Pol(x) * x * x);
+	auto box4 = program.box({ {x, Interval<double>(-10, 10)}, {y, Interval<double>(1, 2)} });
+	EXPECT_TRUE(program.contract(box4, cube, Interval<double>(-8)));
+	EXPECT_TRUE(box4[program.slot(x)].contains(-2.0));
+	EXPECT_LT(box4[program.slot(x)].diameter(), 1e-6);
+
+	// Infeasible constraints leave the box untouched.
+	std::size_t positive = program.add(Pol(x) * x + Rational(1));
+	auto box3 = program.box({ {x, Interval<double>(-2, 2)}, {y, Interval<double>(1.5, 2.0)} });
+	auto copy = box3;
+	EXPECT_FALSE(program.contract(box3, positive, Interval<double>(0.0, BoundType::INFTY, 0.0, BoundType::WEAK)));
+	EXPECT_EQ(copy, box3);
+	EXPECT_FALSE(program.contract(box3, circle, Interval<double>(0)));
+}
+
+TEST(IntervalProgram, ContractInteger)
+{
+	Variable x = freshIntegerVariable("x");
+	Variable y = freshRealVariable("y");
+	using Pol = MultivariatePolynomial<Rational>;
+
+	IntervalProgram<double> program;
+	std::size_t out = program.add(Pol(x) * Rational(2) - y);
+	auto box = program.box({ {x, Interval<double>(-10, 10)}, {y, Interval<double>(2.5, 5.5)} });
+	EXPECT_TRUE(program.contract(box, out, Interval<double>(0)));
+	EXPECT_EQ(Interval<double>(2, 2), box[program.slot(x)]);
+
+	box = program.box({ {x, Interval<double>(-10, 10)}, {y, Interval<double>(2.5, 3.5)} });
+	EXPECT_FALSE(program.contract(box, out, Interval<double>(0)));
+}
+
+TEST(IntervalProgram, Propagate)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	using Pol = MultivariatePolynomial<Rational>;
+
+	// y = x^2 and y = 2 - x intersect at x = 1 and x = -2.
+	IntervalProgram<double> program;
+	std::size_t parabola = program.add(Pol(y) - Pol(x) * x);
+	std::size_t line = program.add(Pol(y) + x - Rational(2));
+	auto box = program.box({ {x, Interval<double>(0, 10)}, {y, Interval<double>(0, 10)} });
+	for (int i = 0; i < 50; ++i) {
+		ASSERT_TRUE(program.contract(box, parabola, Interval<double>(0)));
+		ASSERT_TRUE(program.contract(box, line, Interval<double>(0)));
+	}
+	EXPECT_TRUE(box[program.slot(x)].contains(1.0));
+	EXPECT_TRUE(box[program.slot(y)].contains(1.0));
+	EXPECT_LT(box[program.slot(x)].diameter(), 1e-6);
+	EXPECT_LT(box[program.slot(y)].diameter(), 1e-6);
+}
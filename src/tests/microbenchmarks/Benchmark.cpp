@@ -1,3 +1,81 @@
 #include <benchmark/benchmark.h>
 
-BENCHMARK_MAIN();
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+/**
+ * Counts heap allocations while a benchmark is measured.
+ * The global operator new stores the size of every allocation in front of the allocated memory,
+ * such that the operator delete can also keep track of the bytes in use.
+ * The results are reported by google benchmark as allocs_per_iter and max_bytes_used.
+ */
+namespace allocations {
+	constexpr std::size_t header = alignof(std::max_align_t);
+
+	std::atomic<bool> recording(false);
+	std::atomic<std::int64_t> count(0);
+	std::atomic<std::int64_t> total(0);
+	std::atomic<std::int64_t> current(0);
+	std::atomic<std::int64_t> peak(0);
+
+	void allocated(std::size_t size) {
+		if (!recording.load(std::memory_order_relaxed)) return;
+		count.fetch_add(1, std::memory_order_relaxed);
+		total.fetch_add(std::int64_t(size), std::memory_order_relaxed);
+		std::int64_t now = current.fetch_add(std::int64_t(size), std::memory_order_relaxed) + std::int64_t(size);
+		std::int64_t old = peak.load(std::memory_order_relaxed);
+		while (now > old && !peak.compare_exchange_weak(old, now, std::memory_order_relaxed)) {}
+	}
+	void deallocated(std::size_t size) {
+		if (!recording.load(std::memory_order_relaxed)) return;
+		current.fetch_sub(std::int64_t(size), std::memory_order_relaxed);
+	}
+}
+
+void* operator new(std::size_t size) {
+	void* ptr = std::malloc(size + allocations::header);
+	if (ptr == nullptr) throw std::bad_alloc();
+	*static_cast<std::size_t*>(ptr) = size;
+	allocations::allocated(size);
+	return static_cast<char*>(ptr) + allocations::header;
+}
+void operator delete(void* ptr) noexcept {
+	if (ptr == nullptr) return;
+	void* base = static_cast<char*>(ptr) - allocations::header;
+	allocations::deallocated(*static_cast<std::size_t*>(base));
+	std::free(base);
+}
+void operator delete(void* ptr, std::size_t) noexcept {
+	operator delete(ptr);
+}
+
+class AllocationCounter: public benchmark::MemoryManager {
+public:
+	void Start() override {
+		allocations::count = 0;
+		allocations::total = 0;
+		allocations::current = 0;
+		allocations::peak = 0;
+		allocations::recording = true;
+	}
+	void Stop(Result& result) override {
+		allocations::recording = false;
+		result.num_allocs = allocations::count;
+		result.max_bytes_used = allocations::peak;
+		result.total_allocated_bytes = allocations::total;
+		result.net_heap_growth = allocations::current;
+	}
+};
+
+int main(int argc, char** argv) {
+	AllocationCounter counter;
+	benchmark::RegisterMemoryManager(&counter);
+	benchmark::Initialize(&argc, argv);
+	if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+	benchmark::RunSpecifiedBenchmarks();
+	benchmark::RegisterMemoryManager(nullptr);
+	benchmark::Shutdown();
+	return 0;
+}
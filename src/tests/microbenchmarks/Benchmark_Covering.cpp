@@ -0,0 +1,72 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/util/Bitset.h>
+#include <carl-covering/carl-covering.h>
+
+#include <random>
+
+using carl::covering::SetCover;
+
+/**
+ * Generates a random set cover with the given number of sets and elements.
+ * Every set covers about one in density elements.
+ */
+static SetCover random_cover(std::size_t sets, std::size_t elements, std::size_t density) {
+	std::mt19937 rand(42);
+	SetCover sc;
+	for (std::size_t s = 0; s < sets; ++s) {
+		for (std::size_t e = 0; e < elements; ++e) {
+			if (rand() % density == 0) sc.set(s, e);
+		}
+	}
+	return sc;
+}
+
+static void Covering_Greedy(benchmark::State& state) {
+	auto sets = static_cast<std::size_t>(state.range(0));
+	SetCover sc = random_cover(sets, sets / 2, 16);
+	for (auto _ : state) {
+		SetCover tmp = sc;
+		benchmark::DoNotOptimize(carl::covering::heuristic::greedy(tmp));
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Covering_Greedy)->RangeMultiplier(4)->Range(64, 4096);
+
+/// Many small sets, as in covering problems from CAD, where greedy selects many sets.
+static void Covering_GreedySparse(benchmark::State& state) {
+	auto sets = static_cast<std::size_t>(state.range(0));
+	SetCover sc = random_cover(sets, sets, sets / 8);
+	for (auto _ : state) {
+		SetCover tmp = sc;
+		benchmark::DoNotOptimize(carl::covering::heuristic::greedy(tmp));
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Covering_GreedySparse)->RangeMultiplier(4)->Range(64, 4096);
+
+static void Covering_GreedyWeighted(benchmark::State& state) {
+	auto sets = static_cast<std::size_t>(state.range(0));
+	SetCover sc = random_cover(sets, sets / 2, 16);
+	std::vector<double> weights;
+	for (std::size_t s = 0; s < sets; ++s) {
+		weights.emplace_back(1.0 / static_cast<double>(s % 7 + 1));
+	}
+	for (auto _ : state) {
+		SetCover tmp = sc;
+		benchmark::DoNotOptimize(carl::covering::heuristic::greedy_weighted(tmp, weights));
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Covering_GreedyWeighted)->RangeMultiplier(4)->Range(64, 4096);
+
+static void Covering_Exact(benchmark::State& state) {
+	auto sets = static_cast<std::size_t>(state.range(0));
+	SetCover sc = random_cover(sets, sets, 8);
+	for (auto _ : state) {
+		SetCover tmp = sc;
+		benchmark::DoNotOptimize(carl::covering::heuristic::exact(tmp));
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Covering_Exact)->RangeMultiplier(2)->Range(16, 64);
\ No newline at end of file
@@ -0,0 +1,54 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/formula/Formula.h>
+#include <carl/formula/FormulaPool.h>
+
+using Pol = carl::MultivariatePolynomial<mpq_class>;
+using FormulaT = carl::Formula<Pol>;
+
+static void Formula_Construction(benchmark::State& state) {
+	std::vector<carl::Variable> vars;
+	for (std::int64_t i = 0; i < state.range(0); ++i) {
+		vars.emplace_back(carl::freshRealVariable());
+	}
+	for (auto _ : state) {
+		carl::Formulas<Pol> atoms;
+		for (std::size_t i = 0; i < vars.size(); ++i) {
+			Pol lhs = Pol(vars[i]) * vars[(i + 1) % vars.size()] - mpq_class(static_cast<long>(i));
+			atoms.emplace_back(lhs, carl::Relation::LEQ);
+		}
+		FormulaT f(carl::FormulaType::AND, std::move(atoms));
+		benchmark::DoNotOptimize(f);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Formula_Construction)->RangeMultiplier(4)->Range(4, 256);
+
+/**
+ * Builds a Boolean formula in the shape of a Tseitin encoding and reports the number of nodes it adds to the pool.
+ * Together with max_bytes_used this gives the memory footprint per node, node_size is the size of a single node.
+ */
+static void Formula_PoolMemory(benchmark::State& state) {
+	std::vector<FormulaT> vars;
+	for (std::int64_t i = 0; i < state.range(0); ++i) {
+		vars.emplace_back(carl::freshBooleanVariable());
+	}
+	auto& pool = carl::FormulaPool<Pol>::getInstance();
+	std::size_t nodes = 0;
+	for (auto _ : state) {
+		std::size_t before = pool.size();
+		carl::Formulas<Pol> clauses;
+		for (std::size_t i = 0; i + 2 < vars.size(); ++i) {
+			FormulaT gate(carl::FormulaType::AND, {vars[i], FormulaT(carl::FormulaType::NOT, vars[i + 1])});
+			clauses.push_back(FormulaT(carl::FormulaType::OR, {FormulaT(carl::FormulaType::NOT, gate), vars[i + 2]}));
+			clauses.push_back(FormulaT(carl::FormulaType::IFF, {gate, vars[i + 2]}));
+		}
+		FormulaT f(carl::FormulaType::AND, std::move(clauses));
+		if (pool.size() > before) nodes = std::max(nodes, pool.size() - before);
+		benchmark::DoNotOptimize(f);
+	}
+	state.counters["nodes"] = static_cast<double>(nodes);
+	state.counters["node_size"] = static_cast<double>(sizeof(carl::FormulaContent<Pol>));
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Formula_PoolMemory)->RangeMultiplier(8)->Range(64, 4096);
@@ -0,0 +1,68 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/groebner/groebner.h>
+#include <carl/groebner/benchmarks/cyclic.h>
+#include <carl/groebner/benchmarks/katsura.h>
+#include <carl/numbers/numbers.h>
+
+#include <random>
+
+using Pol = carl::MultivariatePolynomial<mpq_class>;
+
+template<template<typename, template<typename> class> class Procedure>
+void computeBasis(benchmark::State& state, const std::vector<Pol>& input) {
+	// Every benchmark uses fresh variables, hence we select them to be packed.
+	carl::carlVariables vars;
+	for (const auto& p: input) carl::variables(p, vars);
+	std::vector<carl::Variable> packed;
+	for (const auto& v: vars) packed.push_back(carl::underlying_variable(v));
+	carl::MonomialPool::getInstance().setPackedVariables(packed);
+	for (auto _ : state) {
+		carl::GBProcedure<Pol, Procedure, carl::StdAdding> gb;
+		for (const auto& p: input) gb.addPolynomial(p);
+		gb.reduceInput();
+		gb.calculate();
+		benchmark::DoNotOptimize(gb.getBasisPolynomials());
+	}
+}
+
+template<template<typename, template<typename> class> class Procedure>
+static void GB_Katsura(benchmark::State& state) {
+	computeBasis<Procedure>(state, carl::benchmarks::katsura<mpq_class, carl::GrLexOrdering, carl::StdMultivariatePolynomialPolicies<>>(static_cast<unsigned>(state.range(0))));
+}
+BENCHMARK_TEMPLATE(GB_Katsura, carl::Buchberger)->DenseRange(2, 5)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(GB_Katsura, carl::F4)->DenseRange(2, 5)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(GB_Katsura, carl::ModularGB)->DenseRange(2, 5)->Unit(benchmark::kMillisecond);
+
+template<template<typename, template<typename> class> class Procedure>
+static void GB_Cyclic(benchmark::State& state) {
+	computeBasis<Procedure>(state, carl::benchmarks::cyclic<mpq_class, carl::GrLexOrdering, carl::StdMultivariatePolynomialPolicies<>>(static_cast<unsigned>(state.range(0))));
+}
+BENCHMARK_TEMPLATE(GB_Cyclic, carl::Buchberger)->DenseRange(2, 5)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(GB_Cyclic, carl::F4)->DenseRange(2, 5)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(GB_Cyclic, carl::ModularGB)->DenseRange(2, 5)->Unit(benchmark::kMillisecond);
+
+/// Dense quadratic systems in n variables with coefficients from [-range, range), their bases have large coefficients.
+std::vector<Pol> randomQuadratic(unsigned n, int range) {
+	std::mt19937 rand(n * 7 + static_cast<unsigned>(range));
+	auto coeff = [&](){ return Pol(mpq_class(static_cast<int>(rand() % static_cast<unsigned>(2 * range)) - range)); };
+	std::vector<carl::Variable> vars;
+	for (unsigned i = 0; i < n; ++i) vars.push_back(carl::freshRealVariable());
+	std::vector<Pol> res;
+	for (unsigned k = 0; k < n; ++k) {
+		Pol p = coeff();
+		for (unsigned i = 0; i < n; ++i) {
+			p += coeff() * vars[i];
+			for (unsigned j = i; j < n; ++j) p += coeff() * vars[i] * vars[j];
+		}
+		res.push_back(p);
+	}
+	return res;
+}
+
+template<template<typename, template<typename> class> class Procedure>
+static void GB_RandomQuadratic(benchmark::State& state) {
+	computeBasis<Procedure>(state, randomQuadratic(static_cast<unsigned>(state.range(0)), static_cast<int>(state.range(1))));
+}
+BENCHMARK_TEMPLATE(GB_RandomQuadratic, carl::F4)->ArgsProduct({{2, 3, 4}, {10, 1000}})->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(GB_RandomQuadratic, carl::ModularGB)->ArgsProduct({{2, 3, 4}, {10, 1000}})->Unit(benchmark::kMillisecond);
@@ -0,0 +1,74 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/core/MultivariatePolynomial.h>
+#include <carl/interval/IntervalEvaluation.h>
+#include <carl/interval/IntervalProgram.h>
+
+using Pol = carl::MultivariatePolynomial<mpq_class>;
+
+class Interval_Fixture: public benchmark::Fixture {
+public:
+	carl::Variable x = carl::freshRealVariable("x");
+	carl::Variable y = carl::freshRealVariable("y");
+	carl::Variable z = carl::freshRealVariable("z");
+	// A dense polynomial of the given total degree.
+	Pol dense(unsigned degree) const {
+		Pol res;
+		for (unsigned i = 0; i <= degree; ++i) {
+			for (unsigned j = 0; i + j <= degree; ++j) {
+				for (unsigned k = 0; i + j + k <= degree; ++k) {
+					res += Pol(mpq_class(int(i + 2 * j) - int(k), 3)) * carl::pow(Pol(x), i) * carl::pow(Pol(y), j) * carl::pow(Pol(z), k);
+				}
+			}
+		}
+		return res;
+	}
+};
+
+BENCHMARK_DEFINE_F(Interval_Fixture, Interval_Evaluate)(benchmark::State& state) {
+	Pol p = dense(static_cast<unsigned>(state.range(0)));
+	std::map<carl::Variable, carl::Interval<double>> map = {
+		{ x, carl::Interval<double>(-1.0, 2.0) },
+		{ y, carl::Interval<double>(0.5, 1.5) },
+		{ z, carl::Interval<double>(-3.0, -2.0) }
+	};
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(carl::IntervalEvaluation::evaluate(p, map));
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_REGISTER_F(Interval_Fixture, Interval_Evaluate)->DenseRange(2, 8, 2);
+
+BENCHMARK_DEFINE_F(Interval_Fixture, Interval_ProgramEvaluate)(benchmark::State& state) {
+	Pol p = dense(static_cast<unsigned>(state.range(0)));
+	carl::IntervalProgram<double> program;
+	std::size_t out = program.add(p);
+	auto box = program.box({
+		{ x, carl::Interval<double>(-1.0, 2.0) },
+		{ y, carl::Interval<double>(0.5, 1.5) },
+		{ z, carl::Interval<double>(-3.0, -2.0) }
+	});
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(program.evaluate(box, out));
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_REGISTER_F(Interval_Fixture, Interval_ProgramEvaluate)->DenseRange(2, 8, 2);
+
+BENCHMARK_DEFINE_F(Interval_Fixture, Interval_ProgramContract)(benchmark::State& state) {
+	Pol p = dense(static_cast<unsigned>(state.range(0)));
+	carl::IntervalProgram<double> program;
+	std::size_t out = program.add(p);
+	auto initial = program.box({
+		{ x, carl::Interval<double>(-1.0, 2.0) },
+		{ y, carl::Interval<double>(0.5, 1.5) },
+		{ z, carl::Interval<double>(-3.0, -2.0) }
+	});
+	for (auto _ : state) {
+		auto box = initial;
+		benchmark::DoNotOptimize(program.contract(box, out, carl::Interval<double>(0.0)));
+		benchmark::DoNotOptimize(box);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_REGISTER_F(Interval_Fixture, Interval_ProgramContract)->DenseRange(2, 8, 2);
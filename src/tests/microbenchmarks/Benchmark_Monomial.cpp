@@ -0,0 +1,85 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/core/MonomialPool.h>
+
+#include <vector>
+
+namespace {
+	/**
+	 * Creates all monomials in six variables with exponents up to two, such that the first argument selects whether they are packed.
+	 */
+	std::vector<carl::Monomial::Arg> monomials(const benchmark::State& state) {
+		static const std::vector<carl::Variable> vars = []() {
+			std::vector<carl::Variable> res;
+			for (std::size_t i = 0; i < 6; ++i) res.push_back(carl::freshRealVariable());
+			return res;
+		}();
+		carl::MonomialPool::getInstance().setPackedVariables(state.range(0) ? vars : std::vector<carl::Variable>());
+		std::vector<carl::Monomial::Arg> res;
+		for (std::size_t i = 1; i < 729; ++i) {
+			carl::Monomial::Content c;
+			std::size_t digits = i;
+			for (auto v: vars) {
+				if (digits % 3 != 0) c.emplace_back(v, digits % 3);
+				digits /= 3;
+			}
+			res.push_back(carl::createMonomial(std::move(c)));
+		}
+		return res;
+	}
+}
+
+/**
+ * Checks every pair of monomials for divisibility, as done when looking for reducers.
+ */
+static void Monomial_Divisible(benchmark::State& state) {
+	auto ms = monomials(state);
+	for (auto _ : state) {
+		std::size_t count = 0;
+		for (const auto& m1: ms) {
+			for (const auto& m2: ms) {
+				if (m1->divisible(m2)) ++count;
+			}
+		}
+		benchmark::DoNotOptimize(count);
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(ms.size() * ms.size()));
+}
+BENCHMARK(Monomial_Divisible)->Arg(0)->Arg(1);
+
+/**
+ * Compares every pair of monomials with respect to the graded lexical order.
+ */
+static void Monomial_Compare(benchmark::State& state) {
+	auto ms = monomials(state);
+	for (auto _ : state) {
+		std::size_t count = 0;
+		for (const auto& m1: ms) {
+			for (const auto& m2: ms) {
+				if (carl::Monomial::compareGradedLexical(m1, m2) == carl::CompareResult::LESS) ++count;
+			}
+		}
+		benchmark::DoNotOptimize(count);
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(ms.size() * ms.size()));
+}
+BENCHMARK(Monomial_Compare)->Arg(0)->Arg(1);
+
+/**
+ * Computes the lcm and the product of pairs of monomials, whose results already exist in the pool.
+ */
+static void Monomial_LcmProduct(benchmark::State& state) {
+	auto ms = monomials(state);
+	std::vector<carl::Monomial::Arg> alive;
+	for (std::size_t i = 0; i < ms.size(); ++i) {
+		alive.push_back(ms[i] * ms[(i * 7) % ms.size()]);
+	}
+	for (auto _ : state) {
+		for (std::size_t i = 0; i < ms.size(); ++i) {
+			benchmark::DoNotOptimize(carl::Monomial::lcm(ms[i], ms[(i * 7) % ms.size()]));
+			benchmark::DoNotOptimize(ms[i] * ms[(i * 7) % ms.size()]);
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(ms.size()));
+}
+BENCHMARK(Monomial_LcmProduct)->Arg(0)->Arg(1);
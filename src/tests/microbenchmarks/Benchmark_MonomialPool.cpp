@@ -0,0 +1,67 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/core/MonomialPool.h>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace {
+	const carl::Variable x = carl::freshRealVariable("x");
+	const carl::Variable y = carl::freshRealVariable("y");
+	const carl::Variable z = carl::freshRealVariable("z");
+	const int max_threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+}
+
+/**
+ * Every thread repeatedly creates and releases monomials that only this thread uses.
+ * Measures the throughput of insertion and removal in the pool.
+ */
+static void MonomialPool_CreateFree(benchmark::State& state) {
+	carl::exponent offset = static_cast<carl::exponent>(state.thread_index()) * 1000;
+	carl::exponent e = 0;
+	for (auto _ : state) {
+		e = (e + 1) % 1000;
+		auto m = carl::createMonomial(carl::Monomial::Content({std::make_pair(x, offset + e + 1), std::make_pair(y, e + 1), std::make_pair(z, 2)}));
+		benchmark::DoNotOptimize(m);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(MonomialPool_CreateFree)->ThreadRange(1, max_threads)->UseRealTime();
+
+/**
+ * All threads look up the same set of monomials that are kept alive during the benchmark.
+ * Measures the throughput of hash-consing existing monomials.
+ */
+static void MonomialPool_Lookup(benchmark::State& state) {
+	std::vector<carl::Monomial::Arg> alive;
+	for (carl::exponent e = 1; e <= 1000; ++e) {
+		alive.emplace_back(carl::createMonomial(carl::Monomial::Content({std::make_pair(x, e), std::make_pair(y, 1)})));
+	}
+	carl::exponent e = 0;
+	for (auto _ : state) {
+		e = e % 1000 + 1;
+		auto m = carl::createMonomial(carl::Monomial::Content({std::make_pair(x, e), std::make_pair(y, 1)}));
+		benchmark::DoNotOptimize(m);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(MonomialPool_Lookup)->ThreadRange(1, max_threads)->UseRealTime();
+
+/**
+ * Copies and sorts a vector of monomials, as done when copying and sorting terms.
+ * Measures the costs of copying monomial references.
+ */
+static void MonomialPool_CopySort(benchmark::State& state) {
+	std::vector<carl::Monomial::Arg> monomials;
+	for (carl::exponent e = 1; e <= 200; ++e) {
+		monomials.emplace_back(carl::createMonomial(carl::Monomial::Content({std::make_pair(x, e % 13 + 1), std::make_pair(y, e % 7 + 1)})));
+	}
+	for (auto _ : state) {
+		auto copy = monomials;
+		std::sort(copy.begin(), copy.end());
+		benchmark::DoNotOptimize(copy);
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(monomials.size()));
+}
+BENCHMARK(MonomialPool_CopySort);
@@ -3,6 +3,8 @@
 #include <carl/core/MultivariatePolynomial.h>
 #include <carl/numbers/numbers.h>
 
+#include <random>
+
 using MVP = carl::MultivariatePolynomial<mpq_class>;
 
 class MVP_Add_Fixture: public benchmark::Fixture {
@@ -12,7 +14,6 @@ public:
     carl::Variable z = carl::freshRealVariable("z");
     MVP p = MVP(x)*x*x + MVP(x)*y*y + MVP(y)*z;
     MVP q = MVP(x)*x*y + MVP(x)*y*z + MVP(y)*z;
-    static constexpr auto& tam = MVP::mTermAdditionManager;
 };
 
 BENCHMARK_F(MVP_Add_Fixture, MVP_Add)(benchmark::State& state) {
@@ -26,3 +27,37 @@ BENCHMARK_F(MVP_Add_Fixture, MVP_Add_alt)(benchmark::State& state) {
         benchmark::DoNotOptimize(MVP(p) += (q));
     }
 }
+
+/// Random polynomial in n variables with the given number of terms and exponents up to maxExp.
+MVP randomPolynomial(unsigned n, std::size_t terms, unsigned maxExp, unsigned seed) {
+	static std::vector<carl::Variable> vars;
+	while (vars.size() < n) vars.push_back(carl::freshRealVariable());
+	std::mt19937 rand(seed);
+	std::size_t monomials = 1;
+	for (unsigned i = 0; i < n; ++i) monomials *= maxExp + 1;
+	terms = std::min(terms, monomials / 2);
+	MVP res;
+	while (res.nrTerms() < terms) {
+		MVP t(mpq_class(static_cast<int>(rand() % 200) - 100));
+		for (unsigned i = 0; i < n; ++i) {
+			for (unsigned e = rand() % (maxExp + 1); e > 0; --e) t *= vars[i];
+		}
+		res += t;
+	}
+	return res;
+}
+
+/// Compares both multiplication algorithms, arguments are the number of terms and the maximal exponent in four variables.
+template<bool Heap>
+static void MVP_Mul(benchmark::State& state) {
+	MVP p = randomPolynomial(4, static_cast<std::size_t>(state.range(0)), static_cast<unsigned>(state.range(1)), 1);
+	MVP q = randomPolynomial(4, static_cast<std::size_t>(state.range(0)), static_cast<unsigned>(state.range(1)), 2);
+	for (auto _ : state) {
+		MVP r(p);
+		if (Heap) r.multiplyHeap(q);
+		else r.multiplyTermAddition(q);
+		benchmark::DoNotOptimize(r);
+	}
+}
+BENCHMARK_TEMPLATE(MVP_Mul, true)->ArgsProduct({{64, 256, 1024}, {6, 20}})->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(MVP_Mul, false)->ArgsProduct({{64, 256, 1024}, {6, 20}})->Unit(benchmark::kMillisecond);
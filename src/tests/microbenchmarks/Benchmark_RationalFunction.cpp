@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+
+#include <carl-extpolys/CompiledRationalFunction.h>
+#include <carl-extpolys/RationalFunction.h>
+
+using Pol = carl::MultivariatePolynomial<mpq_class>;
+using RFunc = carl::RationalFunction<Pol>;
+
+/// A dense polynomial of the given total degree, as obtained for reachability probabilities in parametric Markov chains.
+static Pol dense_polynomial(const std::vector<carl::Variable>& vars, std::size_t degree, int seed) {
+	Pol res(1);
+	for (std::size_t i = 0; i < vars.size(); ++i) {
+		Pol factor(mpq_class(seed + static_cast<int>(i), 7));
+		for (std::size_t d = 1; d <= degree / vars.size() + 1; ++d) {
+			factor += Pol(mpq_class(static_cast<int>(d) - seed, 3)) * carl::pow(Pol(vars[i]), d);
+		}
+		res *= factor;
+	}
+	return res + Pol(vars.front()) * Pol(vars.back());
+}
+
+struct RF_Evaluation: public benchmark::Fixture {
+	std::vector<carl::Variable> vars;
+	RFunc rf;
+	std::vector<mpq_class> points;
+	std::vector<double> dpoints;
+	std::size_t count = 1024;
+
+	void SetUp(const benchmark::State&) override {
+		vars = { carl::freshRealVariable("p"), carl::freshRealVariable("q"), carl::freshRealVariable("r") };
+		rf = RFunc(dense_polynomial(vars, 6, 2), dense_polynomial(vars, 5, 5));
+		points.clear();
+		dpoints.clear();
+		for (std::size_t i = 0; i < count * vars.size(); ++i) {
+			points.emplace_back(mpq_class(static_cast<int>(i % 97) + 1, 101));
+			dpoints.emplace_back(points.back().get_d());
+		}
+	}
+};
+
+BENCHMARK_F(RF_Evaluation, Map)(benchmark::State& state) {
+	for (auto _ : state) {
+		for (std::size_t i = 0; i < count; ++i) {
+			std::map<carl::Variable, mpq_class> m;
+			for (std::size_t v = 0; v < vars.size(); ++v) m.emplace(vars[v], points[i * vars.size() + v]);
+			benchmark::DoNotOptimize(rf.evaluate(m));
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+
+BENCHMARK_F(RF_Evaluation, CompiledExact)(benchmark::State& state) {
+	carl::CompiledRationalFunction compiled(rf);
+	std::vector<mpq_class> results;
+	for (auto _ : state) {
+		compiled.evaluate_batch(points, results);
+		benchmark::DoNotOptimize(results);
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+
+BENCHMARK_F(RF_Evaluation, CompiledDouble)(benchmark::State& state) {
+	carl::CompiledRationalFunction compiled(rf);
+	std::vector<double> results;
+	for (auto _ : state) {
+		compiled.evaluate_batch(dpoints, results);
+		benchmark::DoNotOptimize(results);
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+
+BENCHMARK_DEFINE_F(RF_Evaluation, CompiledExactThreads)(benchmark::State& state) {
+	carl::CompiledRationalFunction compiled(rf);
+	std::vector<mpq_class> results;
+	for (auto _ : state) {
+		compiled.evaluate_batch(points, results, 4);
+		benchmark::DoNotOptimize(results);
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+// The main thread only waits for the workers, hence the cpu time is meaningless.
+BENCHMARK_REGISTER_F(RF_Evaluation, CompiledExactThreads)->UseRealTime();
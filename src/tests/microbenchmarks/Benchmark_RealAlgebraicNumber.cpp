@@ -1,7 +1,7 @@
 #include <benchmark/benchmark.h>
 
-#include <carl/formula/model/ran/RootFinder.h>
-#include <carl/formula/model/ran/RealAlgebraicNumber.h>
+#include <carl/formula/model/ran/real_roots.h>
+#include <carl/formula/model/ran/ran_operations.h>
 
 using Poly = carl::UnivariatePolynomial<mpq_class>;
 
@@ -17,25 +17,39 @@ BENCHMARK_F(RAN_Fixture, RAN_Create)(benchmark::State& state) {
 	auto i = rans[0].interval();
 	for (auto _ : state) {
 		auto ran = carl::RealAlgebraicNumber<mpq_class>(p, i);
+		benchmark::DoNotOptimize(ran);
 	}
+	state.SetItemsProcessed(state.iterations());
 }
 
-BENCHMARK_F(RAN_Fixture, RAN_CreateRefineOld)(benchmark::State& state) {
-	auto rans = carl::realRoots(p);
-	auto p = rans[0].polynomial();
-	auto i = rans[0].interval();
+BENCHMARK_F(RAN_Fixture, RAN_Compare)(benchmark::State& state) {
+	auto lhs = carl::realRoots(p);
+	auto rhs = carl::realRoots(Poly(x, {-3, 0, 1}));
 	for (auto _ : state) {
-		auto ran = carl::RealAlgebraicNumber<mpq_class>(p, i);
-		ran.refine(false);
+		benchmark::DoNotOptimize(lhs[1] < rhs[1]);
 	}
+	state.SetItemsProcessed(state.iterations());
 }
 
-BENCHMARK_F(RAN_Fixture, RAN_CreateRefineNew)(benchmark::State& state) {
-	auto rans = carl::realRoots(p);
-	auto p = rans[0].polynomial();
-	auto i = rans[0].interval();
+
+/// Compares numbers with overlapping isolating intervals, which requires refinement unless the double filter decides.
+BENCHMARK_F(RAN_Fixture, RAN_CompareClose)(benchmark::State& state) {
+	Poly q = Poly(x, {-20001, 0, 10000});
+	carl::Interval<mpq_class> i(1, carl::BoundType::STRICT, 2, carl::BoundType::STRICT);
 	for (auto _ : state) {
-		auto ran = carl::RealAlgebraicNumber<mpq_class>(p, i);
-		ran.refine(true);
+		carl::RealAlgebraicNumber<mpq_class> lhs(p, i);
+		carl::RealAlgebraicNumber<mpq_class> rhs(q, i);
+		benchmark::DoNotOptimize(lhs < rhs);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_F(RAN_Fixture, RAN_SignClose)(benchmark::State& state) {
+	Poly q = Poly(x, {-20001, 0, 10000});
+	carl::Interval<mpq_class> i(1, carl::BoundType::STRICT, 2, carl::BoundType::STRICT);
+	for (auto _ : state) {
+		carl::RealAlgebraicNumber<mpq_class> ran(p, i);
+		benchmark::DoNotOptimize(ran.sgn(q));
 	}
+	state.SetItemsProcessed(state.iterations());
 }
@@ -1,7 +1,7 @@
 #include <benchmark/benchmark.h>
 
-#include <carl/formula/model/ran/RootFinder.h>
-//#include <carl/formula/model/ran/RealAlgebraicNumber.h>
+#include <carl/formula/model/ran/real_roots.h>
+#include <carl/core/polynomialfunctions/Chebyshev.h>
 
 using Poly = carl::UnivariatePolynomial<mpq_class>;
 
@@ -15,7 +15,9 @@ BENCHMARK_F(RF_Fixture, Real_Roots_1)(benchmark::State& state) {
 
 	for (auto _ : state) {
 		auto rans = carl::realRoots(p, carl::Interval<mpq_class>::unboundedInterval());
+		benchmark::DoNotOptimize(rans);
 	}
+	state.SetItemsProcessed(state.iterations());
 }
 
 BENCHMARK_F(RF_Fixture, Real_Roots_2)(benchmark::State& state) {
@@ -41,8 +43,78 @@ BENCHMARK_F(RF_Fixture, Real_Roots_2)(benchmark::State& state) {
 
 	for (auto _ : state) {
 		auto rans = carl::realRoots(p, carl::Interval<mpq_class>::unboundedInterval());
+		benchmark::DoNotOptimize(rans);
 	}
+	state.SetItemsProcessed(state.iterations());
 }
 
+using carl::ran::interval::IsolationStrategy;
 
+/// Mignotte polynomial x^n - 2(10x-1)^2 with two roots very close to 1/10.
+static Poly mignotte(carl::Variable x, std::size_t degree) {
+	std::vector<mpq_class> coeffs(degree + 1, 0);
+	coeffs[0] = -2;
+	coeffs[1] = 40;
+	coeffs[2] = -200;
+	coeffs[degree] = 1;
+	return Poly(x, coeffs);
+}
+
+static void RootIsolation_Mignotte(benchmark::State& state) {
+	carl::Variable x = carl::freshRealVariable("x");
+	Poly p = mignotte(x, static_cast<std::size_t>(state.range(0)));
+	auto strategy = static_cast<IsolationStrategy>(state.range(1));
+	for (auto _ : state) {
+		carl::ran::interval::RealRootIsolation<mpq_class> rri(p, carl::Interval<mpq_class>::unboundedInterval(), strategy);
+		benchmark::DoNotOptimize(rri.get_roots());
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(RootIsolation_Mignotte)->ArgsProduct({{50, 100}, {int(IsolationStrategy::Bisection), int(IsolationStrategy::VCA), int(IsolationStrategy::Sturm)}})->Unit(benchmark::kMillisecond);
 
+/// Chebyshev polynomials have many real roots that cluster at -1 and 1.
+static void RootIsolation_Chebyshev(benchmark::State& state) {
+	carl::Chebyshev<mpq_class> chebyshev(carl::freshRealVariable("x"));
+	Poly p = chebyshev(static_cast<std::size_t>(state.range(0)));
+	auto strategy = static_cast<IsolationStrategy>(state.range(1));
+	for (auto _ : state) {
+		carl::ran::interval::RealRootIsolation<mpq_class> rri(p, carl::Interval<mpq_class>::unboundedInterval(), strategy);
+		benchmark::DoNotOptimize(rri.get_roots());
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(RootIsolation_Chebyshev)->ArgsProduct({{50, 100}, {int(IsolationStrategy::Bisection), int(IsolationStrategy::VCA), int(IsolationStrategy::Sturm)}})->Unit(benchmark::kMillisecond);
+
+/// A family of polynomials as encountered in a CAD lifting step: every polynomial is the product of three of a few irreducible factors.
+static std::vector<Poly> factor_family(carl::Variable x, std::size_t size) {
+	std::vector<Poly> factors;
+	for (int i = 2; i < 8; ++i) {
+		factors.emplace_back(x, std::initializer_list<mpq_class>{-i, 0, 0, 1});
+		factors.emplace_back(x, std::initializer_list<mpq_class>{-i, 1, 1});
+	}
+	std::vector<Poly> res;
+	for (std::size_t i = 0; i < size; ++i) {
+		res.emplace_back(factors[i % factors.size()] * factors[(3*i + 1) % factors.size()] * factors[(7*i + 5) % factors.size()]);
+	}
+	return res;
+}
+
+static void RootIsolation_Family(benchmark::State& state) {
+	auto polys = factor_family(carl::freshRealVariable("x"), static_cast<std::size_t>(state.range(0)));
+	for (auto _ : state) {
+		for (const auto& p: polys) {
+			benchmark::DoNotOptimize(carl::realRoots(p));
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(RootIsolation_Family)->Arg(8)->Arg(32)->Unit(benchmark::kMillisecond);
+
+static void RootIsolation_FamilyBatched(benchmark::State& state) {
+	auto polys = factor_family(carl::freshRealVariable("x"), static_cast<std::size_t>(state.range(0)));
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(carl::batchRealRoots(polys));
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(RootIsolation_FamilyBatched)->Arg(8)->Arg(32)->Unit(benchmark::kMillisecond);
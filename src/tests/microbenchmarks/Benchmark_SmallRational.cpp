@@ -0,0 +1,59 @@
+#include <benchmark/benchmark.h>
+
+#include <carl/core/MultivariatePolynomial.h>
+#include <carl/core/UnivariatePolynomial.h>
+#include <carl/core/polynomialfunctions/GCD.h>
+#include <carl/numbers/numbers.h>
+
+#include <vector>
+
+// Compares SmallRational to mpq_class on numbers that mostly fit into machine integers.
+
+template<typename Number>
+static void Rational_Arithmetic(benchmark::State& state) {
+	std::vector<Number> numbers;
+	for (int i = 1; i <= 64; ++i) {
+		numbers.emplace_back(Number(i % 7 - 3) / Number(i % 5 + 1));
+	}
+	for (auto _ : state) {
+		Number sum(0);
+		for (std::size_t i = 0; i < numbers.size(); ++i) {
+			sum += numbers[i] * numbers[(i + 1) % numbers.size()] - numbers[(i + 2) % numbers.size()];
+		}
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(numbers.size()));
+}
+BENCHMARK_TEMPLATE(Rational_Arithmetic, mpq_class);
+BENCHMARK_TEMPLATE(Rational_Arithmetic, carl::SmallRational);
+
+template<typename Number>
+static void Rational_MultivariateProduct(benchmark::State& state) {
+	using Pol = carl::MultivariatePolynomial<Number>;
+	carl::Variable x = carl::freshRealVariable("x");
+	carl::Variable y = carl::freshRealVariable("y");
+	carl::Variable z = carl::freshRealVariable("z");
+	Pol p = Pol(x) * Number(1) / Number(2) + Pol(y) * Number(3) - Pol(z) * Number(2) / Number(3) + Number(1);
+	Pol q = Pol(x) * y - Pol(z) * z * Number(5) / Number(4) + Number(2);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(carl::pow(p, 4) * carl::pow(q, 3));
+	}
+}
+BENCHMARK_TEMPLATE(Rational_MultivariateProduct, mpq_class);
+BENCHMARK_TEMPLATE(Rational_MultivariateProduct, carl::SmallRational);
+
+template<typename Number>
+static void Rational_UnivariateGCD(benchmark::State& state) {
+	using UPol = carl::UnivariatePolynomial<Number>;
+	carl::Variable x = carl::freshRealVariable("x");
+	UPol f(x, { Number(-2), Number(0), Number(1) });
+	UPol g(x, { Number(1), Number(-3), Number(1), Number(2) });
+	UPol h(x, { Number(3), Number(1), Number(0), Number(-1), Number(1) });
+	UPol a = f * g * g;
+	UPol b = f * h;
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(carl::gcd(a, b));
+	}
+}
+BENCHMARK_TEMPLATE(Rational_UnivariateGCD, mpq_class);
+BENCHMARK_TEMPLATE(Rational_UnivariateGCD, carl::SmallRational);
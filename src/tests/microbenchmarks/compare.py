@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+"""
+Compares two runs of runMicroBenchmarks and flags regressions.
+
+Both runs are expected in the JSON format of google benchmark, e.g. obtained by
+    runMicroBenchmarks --benchmark_out=run.json --benchmark_out_format=json
+The time per iteration is compared for all benchmarks present in both runs.
+If the new run is slower by more than the threshold, the benchmark is reported as a regression
+and the script exits with a non-zero status.
+"""
+
+import argparse
+import csv
+import json
+import sys
+
+TIME_UNITS = {"ns": 1, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load(filename, metric):
+	"""Returns a map from benchmark names to (time in ns, allocations per iteration)."""
+	with open(filename) as f:
+		data = json.load(f)
+	res = {}
+	for b in data["benchmarks"]:
+		# With repetitions, only the mean is compared.
+		if b.get("run_type") == "aggregate" and b.get("aggregate_name") != "mean":
+			continue
+		if b.get("run_type") == "iteration" and b.get("repetitions", 1) > 1:
+			continue
+		name = b.get("run_name", b["name"])
+		time = b[metric] * TIME_UNITS[b.get("time_unit", "ns")]
+		res[name] = (time, b.get("allocs_per_iter"))
+	return res
+
+
+def main():
+	parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+	parser.add_argument("baseline", help="JSON output of the baseline run")
+	parser.add_argument("contender", help="JSON output of the new run")
+	parser.add_argument("--threshold", type=float, default=5.0, help="relative slowdown in percent that is considered a regression (default: 5)")
+	parser.add_argument("--metric", choices=["real_time", "cpu_time"], default="cpu_time", help="time to compare (default: cpu_time)")
+	parser.add_argument("--csv", help="also write the comparison to this CSV file")
+	args = parser.parse_args()
+
+	baseline = load(args.baseline, args.metric)
+	contender = load(args.contender, args.metric)
+	rows = []
+	for name, (old, old_allocs) in baseline.items():
+		if name not in contender:
+			continue
+		new, new_allocs = contender[name]
+		change = (new - old) / old * 100 if old > 0 else 0.0
+		status = "REGRESSION" if change > args.threshold else ("improved" if change < -args.threshold else "")
+		rows.append([name, old, new, change, old_allocs, new_allocs, status])
+
+	width = max([len(r[0]) for r in rows] + [len("Benchmark")])
+	print("{:<{w}} {:>14} {:>14} {:>9} {:>12} {:>12}".format("Benchmark", "old [ns]", "new [ns]", "change", "old allocs", "new allocs", w=width))
+	for r in rows:
+		allocs = ["{:12.1f}".format(a) if a is not None else "{:>12}".format("-") for a in r[4:6]]
+		print("{:<{w}} {:14.1f} {:14.1f} {:+8.1f}% {} {} {}".format(r[0], r[1], r[2], r[3], allocs[0], allocs[1], r[6], w=width))
+	for name in sorted(set(baseline) ^ set(contender)):
+		print("{:<{w}} only in {}".format(name, "baseline" if name in baseline else "contender", w=width))
+
+	if args.csv:
+		with open(args.csv, "w", newline="") as f:
+			writer = csv.writer(f)
+			writer.writerow(["name", "old_ns", "new_ns", "change_percent", "old_allocs_per_iter", "new_allocs_per_iter", "status"])
+			writer.writerows(rows)
+
+	regressions = [r for r in rows if r[6] == "REGRESSION"]
+	if regressions:
+		print("{} of {} benchmarks regressed by more than {}%".format(len(regressions), len(rows), args.threshold))
+		return 1
+	return 0
+
+
+if __name__ == "__main__":
+	sys.exit(main())
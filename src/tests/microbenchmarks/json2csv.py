@@ -0,0 +1,43 @@
+#!/usr/bin/env python3
+"""
+Converts the JSON output of runMicroBenchmarks to CSV.
+
+The columns are those of the CSV format of google benchmark, followed by all counters,
+for example allocs_per_iter and max_bytes_used as reported by the memory manager.
+Hence the suite only has to be run once to obtain both formats.
+"""
+
+import argparse
+import csv
+import json
+import sys
+
+COLUMNS = ["name", "iterations", "real_time", "cpu_time", "time_unit", "bytes_per_second", "items_per_second", "label", "error_occurred", "error_message"]
+# Fields of the JSON output that are neither columns nor counters.
+METADATA = {"family_index", "per_family_instance_index", "run_name", "run_type", "repetitions", "repetition_index", "threads", "aggregate_name", "aggregate_unit"}
+
+
+def main():
+	parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+	parser.add_argument("input", help="JSON output of runMicroBenchmarks")
+	parser.add_argument("output", help="CSV file to write")
+	args = parser.parse_args()
+
+	with open(args.input) as f:
+		benchmarks = json.load(f)["benchmarks"]
+	counters = []
+	for b in benchmarks:
+		for key in b:
+			if key not in COLUMNS and key not in METADATA and key not in counters:
+				counters.append(key)
+
+	with open(args.output, "w", newline="") as f:
+		writer = csv.writer(f)
+		writer.writerow(COLUMNS + counters)
+		for b in benchmarks:
+			writer.writerow([b.get(key, "") for key in COLUMNS + counters])
+	return 0
+
+
+if __name__ == "__main__":
+	sys.exit(main())
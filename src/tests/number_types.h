@@ -16,7 +16,8 @@ using RationalTypes = testing::Types<
 	#ifdef USE_CLN_NUMBERS
 	cln::cl_RA,
 	#endif
-	mpq_class
+	mpq_class,
+	carl::SmallRational
 >;
 
 using NumberTypes = testing::Types<
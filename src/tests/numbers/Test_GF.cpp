@@ -68,3 +68,98 @@ TEST(GaloisField, integers)
 
 
 
+
+TEST(GaloisField, symmetricModulo)
+{
+    GaloisField<mpz_class> gf7(7);
+    EXPECT_EQ(mpz_class(3), gf7.modulo(mpz_class(3)));
+    EXPECT_EQ(mpz_class(-3), gf7.modulo(mpz_class(4)));
+    EXPECT_EQ(mpz_class(0), gf7.modulo(mpz_class(14)));
+    // Negative numbers are mapped into the symmetric range as well.
+    EXPECT_EQ(mpz_class(-1), gf7.modulo(mpz_class(-1)));
+    EXPECT_EQ(mpz_class(-3), gf7.modulo(mpz_class(-3)));
+    EXPECT_EQ(mpz_class(3), gf7.modulo(mpz_class(-4)));
+    EXPECT_EQ(mpz_class(-3), gf7.modulo(mpz_class(-10)));
+    EXPECT_EQ(mpz_class(3), gf7.modulo(mpz_class(-11)));
+    EXPECT_EQ(mpz_class(0), gf7.modulo(mpz_class(-21)));
+}
+
+TEST(GaloisField, compoundOperators)
+{
+    const GaloisField<mpz_class>* gf5 = GaloisFieldManager<mpz_class>::getInstance().getField(5,1);
+    // The compound operators keep the representing integer in the symmetric range.
+    GFNumber<mpz_class> a(3,gf5);
+    a += GFNumber<mpz_class>(3,gf5);
+    EXPECT_EQ(mpz_class(1), a.representingInteger());
+    a -= GFNumber<mpz_class>(2,gf5);
+    EXPECT_EQ(mpz_class(-1), a.representingInteger());
+    GFNumber<mpz_class> b(2,gf5);
+    b *= GFNumber<mpz_class>(2,gf5);
+    EXPECT_EQ(mpz_class(-1), b.representingInteger());
+    b += mpz_class(8);
+    EXPECT_EQ(mpz_class(2), b.representingInteger());
+    b *= mpz_class(4);
+    EXPECT_EQ(mpz_class(-2), b.representingInteger());
+}
+
+TEST(GaloisField, division)
+{
+    const GaloisField<mpz_class>* gf5 = GaloisFieldManager<mpz_class>::getInstance().getField(5,1);
+    GFNumber<mpz_class> a2(2,gf5);
+    GFNumber<mpz_class> a3(3,gf5);
+    // 2 / 3 = 2 * 2 = 4 in GF(5).
+    EXPECT_EQ(GFNumber<mpz_class>(4,gf5), a2 / a3);
+    GFNumber<mpz_class> a = a2;
+    a /= a3;
+    EXPECT_EQ(mpz_class(-1), a.representingInteger());
+
+    // Dividing by one does not need a field.
+    GFNumber<mpz_class> one(1);
+    EXPECT_EQ(a2, a2 / one);
+    a = a2;
+    a /= one;
+    EXPECT_EQ(mpz_class(2), a.representingInteger());
+}
+
+TEST(GaloisField, symmetricModuloSmallFields)
+{
+    // Every number has a unique representative in (-p/2, p/2], also in fields of even size.
+    GaloisField<mpz_class> gf2(2);
+    EXPECT_EQ(mpz_class(1), gf2.modulo(mpz_class(1)));
+    EXPECT_EQ(mpz_class(1), gf2.modulo(mpz_class(-1)));
+    EXPECT_EQ(mpz_class(1), gf2.modulo(mpz_class(3)));
+    EXPECT_EQ(mpz_class(0), gf2.modulo(mpz_class(-4)));
+    GaloisField<mpz_class> gf3(3);
+    EXPECT_EQ(mpz_class(-1), gf3.modulo(mpz_class(2)));
+    EXPECT_EQ(mpz_class(1), gf3.modulo(mpz_class(-2)));
+}
+
+TEST(GaloisField, nativeIntegers)
+{
+    // Native integers are reduced by Barrett reduction and agree with the reduction of gmp integers.
+    for (sint p: {sint(2), sint(7), sint(65537), sint(1073741827), sint(2147483647)}) {
+        GaloisField<sint> gf(static_cast<unsigned>(p));
+        GaloisField<mpz_class> gfz(static_cast<unsigned>(p));
+        EXPECT_EQ(p, gf.size());
+        std::vector<sint> numbers = {0, 1, -1, p - 1, p, p + 1, -p, 2 * p, -2 * p + 1, p / 2, p / 2 + 1, -(p / 2)};
+        sint half = p / 2;
+        numbers.push_back(half * half);
+        numbers.push_back(-half * half);
+        numbers.push_back(half * (half - 1) + p / 3);
+        numbers.push_back((sint(1) << 62) - 1);
+        numbers.push_back(-(sint(1) << 62) + 1);
+        for (sint n: numbers) {
+            EXPECT_EQ(gfz.modulo(fromInt<mpz_class>(n)), fromInt<mpz_class>(gf.modulo(n))) << n << " mod " << p;
+        }
+    }
+
+    const GaloisField<sint>* gf = GaloisFieldManager<sint>::getInstance().getField(1073741827);
+    GFNumber<sint> a(123456789, gf);
+    GFNumber<sint> b(-987654321, gf);
+    EXPECT_EQ(GFNumber<sint>(1, gf), a * a.inverse());
+    EXPECT_EQ(a, (a * b) / b);
+    GFNumber<sint> c = a;
+    c *= b;
+    c -= a * b;
+    EXPECT_TRUE(c.isZero());
+}
@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+
+#include <carl/core/MultivariatePolynomial.h>
+#include <carl/core/UnivariatePolynomial.h>
+#include <carl/core/polynomialfunctions/Division.h>
+#include <carl/core/polynomialfunctions/GCD.h>
+#include <carl/interval/Interval.h>
+#include <carl/numbers/numbers.h>
+
+#include <limits>
+#include <random>
+#include <sstream>
+#include <vector>
+
+using namespace carl;
+
+namespace {
+	const sint max = std::numeric_limits<sint>::max();
+	const sint min = std::numeric_limits<sint>::min();
+
+	template<typename T>
+	std::string str(const T& t) {
+		std::stringstream ss;
+		ss << t;
+		return ss.str();
+	}
+}
+
+TEST(SmallRational, Constructors)
+{
+	EXPECT_TRUE(SmallRational().is_small());
+	EXPECT_EQ(SmallRational(), SmallRational(0));
+	EXPECT_EQ(SmallRational(2, 4), SmallRational(1, 2));
+	EXPECT_EQ(SmallRational(2, -4), SmallRational(-1, 2));
+	EXPECT_EQ(SmallRational(0, -4), SmallRational(0));
+	EXPECT_EQ(mpq_class(3, 7), SmallRational(3, 7).to_mpq());
+
+	EXPECT_TRUE(SmallRational(max).is_small());
+	EXPECT_FALSE(SmallRational(min).is_small());
+	EXPECT_FALSE(SmallRational(std::numeric_limits<carl::uint>::max()).is_small());
+	EXPECT_EQ(carl::fromInt<mpq_class>(min), SmallRational(min).to_mpq());
+	EXPECT_TRUE(SmallRational(min, 2).is_small());
+	EXPECT_EQ(SmallRational(min / 2), SmallRational(min, 2));
+
+	mpq_class large = carl::fromInt<mpq_class>(max) * 4;
+	EXPECT_FALSE(SmallRational(large).is_small());
+	EXPECT_TRUE(SmallRational(large / 8).is_small());
+	EXPECT_EQ(large, SmallRational(large).to_mpq());
+}
+
+TEST(SmallRational, PromoteAndDemote)
+{
+	SmallRational a(max);
+	a += SmallRational(1);
+	EXPECT_FALSE(a.is_small());
+	EXPECT_EQ(carl::fromInt<mpq_class>(max) + 1, a.to_mpq());
+	a -= SmallRational(1);
+	EXPECT_TRUE(a.is_small());
+	EXPECT_EQ(SmallRational(max), a);
+
+	SmallRational b(max);
+	b *= b;
+	EXPECT_FALSE(b.is_small());
+	b /= SmallRational(max);
+	EXPECT_TRUE(b.is_small());
+	EXPECT_EQ(SmallRational(max), b);
+
+	SmallRational c(1, max);
+	c = c * SmallRational(1, max - 1);
+	EXPECT_FALSE(c.is_small());
+	EXPECT_TRUE(SmallRational(1, max) > c);
+	EXPECT_TRUE(isPositive(c));
+	c *= SmallRational(max - 1);
+	EXPECT_TRUE(c.is_small());
+	EXPECT_EQ(SmallRational(1, max), c);
+
+	EXPECT_FALSE((-SmallRational(max) - SmallRational(1)).is_small());
+	EXPECT_EQ(-SmallRational(max) - SmallRational(1), SmallRational(min));
+}
+
+TEST(SmallRational, CompareWithGMP)
+{
+	std::mt19937 rand(42);
+	std::vector<sint> values = { 0, 1, -1, 2, -3, 7, 12, -30, max, -max, max - 1, max / 3, -(max / 5) };
+	std::uniform_int_distribution<sint> dist(-max, max);
+	for (int i = 0; i < 10; ++i) values.emplace_back(dist(rand));
+	std::vector<SmallRational> numbers;
+	for (sint num: values) {
+		for (sint den: { sint(1), sint(2), sint(-9), max, sint(1) << 40 }) {
+			numbers.emplace_back(num, den);
+		}
+	}
+	for (const auto& a: numbers) {
+		mpq_class qa = a.to_mpq();
+		EXPECT_EQ(carl::floor(qa), carl::floor(a));
+		EXPECT_EQ(carl::ceil(qa), carl::ceil(a));
+		EXPECT_EQ(carl::round(qa), carl::round(a));
+		EXPECT_EQ(carl::bitsize(qa), carl::bitsize(a));
+		EXPECT_EQ(str(qa), str(a));
+		for (const auto& b: numbers) {
+			mpq_class qb = b.to_mpq();
+			EXPECT_EQ(qa + qb, (a + b).to_mpq());
+			EXPECT_EQ(qa - qb, (a - b).to_mpq());
+			EXPECT_EQ(qa * qb, (a * b).to_mpq());
+			if (!carl::isZero(b)) {
+				EXPECT_EQ(mpq_class(qa / qb), (a / b).to_mpq());
+			}
+			EXPECT_EQ(qa == qb, a == b);
+			EXPECT_EQ(qa < qb, a < b);
+			EXPECT_EQ(qa >= qb, a >= b);
+			EXPECT_EQ(carl::gcd(qa, qb), carl::gcd(a, b).to_mpq());
+			EXPECT_EQ(carl::lcm(qa, qb), carl::lcm(a, b).to_mpq());
+		}
+	}
+}
+
+TEST(SmallRational, Polynomials)
+{
+	using MP = MultivariatePolynomial<mpq_class>;
+	using MS = MultivariatePolynomial<SmallRational>;
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+
+	MP p = MP(x) * mpq_class(1, 3) + MP(y) * y * mpq_class(2) - mpq_class(max);
+	MS s = MS(x) * SmallRational(1, 3) + MS(y) * y * SmallRational(2) - SmallRational(max);
+	EXPECT_EQ(str(p), str(s));
+	EXPECT_EQ(str(p * p * p), str(s * s * s));
+	EXPECT_EQ(str(p * p - p), str(s * s - s));
+
+	using UP = UnivariatePolynomial<mpq_class>;
+	using US = UnivariatePolynomial<SmallRational>;
+	UP up(x, { mpq_class(-6), mpq_class(11), mpq_class(-6), mpq_class(1) });
+	US us(x, { SmallRational(-6), SmallRational(11), SmallRational(-6), SmallRational(1) });
+	UP uq(x, { mpq_class(2), mpq_class(-3), mpq_class(1) });
+	US uqs(x, { SmallRational(2), SmallRational(-3), SmallRational(1) });
+	EXPECT_EQ(str(carl::gcd(up, uq)), str(carl::gcd(us, uqs)));
+	EXPECT_EQ(str(carl::divide(up * up, uq).quotient), str(carl::divide(us * us, uqs).quotient));
+
+	Interval<SmallRational> i(SmallRational(-1, 2), SmallRational(3));
+	EXPECT_EQ(Interval<SmallRational>(SmallRational(-3, 2), SmallRational(9)), i * i);
+	EXPECT_TRUE(i.contains(SmallRational(0)));
+	EXPECT_EQ(SmallRational(5, 4), i.center());
+}